@@ -6,13 +6,46 @@
 #ifndef DOUBLY_LINKED_H
 #define DOUBLY_LINKED_H
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using std::cout;
 using std::endl;
 using std::vector;
 
+template <typename T> class ListView;
+template <typename V> class SliceView;
+template <typename V, typename P> class FilterView;
+
 /**
  * @brief Node struct for the elements of the doubly linked list.
  * @tparam T The type of data stored in the node.
@@ -35,7 +68,28 @@ private:
     Node<T> *tail = nullptr;
     int count = 0;
 
+    //Node pool: nodes are carved out of blocks sized to the list's length,
+    //so compact() can relocate them into one block. A block is freed as
+    //soon as its last node is destroyed.
+    struct PoolBlock {
+        size_t capacity;
+        size_t bumped;    //Slots handed out at least once
+        size_t live;
+        Node<T> *freeList;    //Freed slots, each holding the next one
+    };
+    std::map<Node<T>*, PoolBlock> blocks;    //Keyed by first slot
+    Node<T> *allocBlock = nullptr;    //Block new nodes come from
+    vector<Node<T>*> partialBlocks;    //Blocks that had slots freed; may be stale
+    int jumps = 0;    //Links whose next node is not the adjacent slot
+    bool autoCompact = false;
+    double autoCompactThreshold = 0.5;
+
     Node<T>* createNewNode(T d);
+    void destroyNode(Node<T> *node);
+    Node<T>* addBlock(size_t capacity);
+    bool hasRoom(Node<T> *key);
+    void releaseBlocks();
+    void setNext(Node<T> *node, Node<T> *next);
     bool deleteAfter(Node<T> *prevNode);
     void insert_After(Node<T> *prevNode, T value);
 
@@ -46,6 +100,7 @@ public:
 
     //Copy constructor 
     DoublyLinked(const DoublyLinked &);
+    DoublyLinked &operator=(const DoublyLinked &);
 
     //List manipulation function 
     void push_front(T value);
@@ -61,6 +116,28 @@ public:
     bool reverseList();
     void deleteItem(T value);
     vector<Node<T>*> searchItems(T value);
+
+    //Lazy, non-owning views; they are invalidated by changes to the list
+    ListView<T> view();
+    ListView<T> reversed();
+    SliceView<ListView<T>> slice(int from, int to);
+    template <typename P>
+    FilterView<ListView<T>, P> filter(P pred);
+
+    //Node-level access used by LruCache, all O(1)
+    Node<T>* frontNode();
+    Node<T>* backNode();
+    void moveToFront(Node<T> *node);
+    void removeNode(Node<T> *node);
+
+    //Node pool sizing
+    void reserveNodes(int n);
+
+    //Traversal locality
+    double fragmentation();
+    void compact();
+    bool maybeCompact(double threshold);
+    void setAutoCompact(bool enabled, double threshold = 0.5);
 };
 
 /**
@@ -84,14 +161,151 @@ DoublyLinked<T>::DoublyLinked() {
  */
 template <typename T>
 Node<T>* DoublyLinked<T>::createNewNode(T d) {
-    Node<T> *newNode = new Node<T>;
-    if (newNode == nullptr) {
-        throw std::bad_alloc();
+    if (!hasRoom(allocBlock)) {
+        allocBlock = nullptr;
+        while (!partialBlocks.empty()) {
+            Node<T> *key = partialBlocks.back();
+            partialBlocks.pop_back();
+            if (hasRoom(key)) {
+                allocBlock = key;
+                break;
+            }
+        }
+        if (allocBlock == nullptr)
+            addBlock(std::min<size_t>(std::max(count, 1), 4096));
+    }
+
+    PoolBlock &block = blocks.find(allocBlock)->second;
+    Node<T> *slot;
+    if (block.freeList != nullptr) {
+        slot = block.freeList;
+        block.freeList = *std::launder(reinterpret_cast<Node<T>**>(slot));
+    } else {
+        slot = allocBlock + block.bumped++;
+    }
+    try {
+        new (slot) Node<T>{nullptr, d, nullptr};
+    } catch (...) {
+        new (slot) Node<T>*(block.freeList);
+        block.freeList = slot;
+        throw;
+    }
+    block.live++;
+    return slot;
+}
+
+/**
+ * @brief Destroys a node and returns its slot to its block, freeing the
+ * block once no node in it is left.
+ * 
+ * @tparam T The type of data stored in the node.
+ * @param node The node to be destroyed.
+ */
+template <typename T>
+void DoublyLinked<T>::destroyNode(Node<T> *node) {
+    setNext(node, nullptr);
+    node->~Node<T>();
+
+    auto it = std::prev(blocks.upper_bound(node));
+    PoolBlock &block = it->second;
+    if (--block.live == 0) {
+        if (allocBlock == it->first)
+            allocBlock = nullptr;
+        ::operator delete(it->first);
+        blocks.erase(it);
+        return;
+    }
+    if (block.freeList == nullptr)
+        partialBlocks.push_back(it->first);
+    new (node) Node<T>*(block.freeList);
+    block.freeList = node;
+}
+
+/**
+ * @brief Allocates a pool block and makes it the one new nodes come from.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param capacity Number of node slots in the block.
+ * @return Node<T>* The first slot of the block.
+ */
+template <typename T>
+Node<T>* DoublyLinked<T>::addBlock(size_t capacity) {
+    Node<T> *key = static_cast<Node<T>*>(::operator new(capacity * sizeof(Node<T>)));
+    blocks.emplace(key, PoolBlock{capacity, 0, 0, nullptr});
+    if (allocBlock != nullptr)
+        partialBlocks.push_back(allocBlock);
+    allocBlock = key;
+    return key;
+}
+
+/**
+ * @brief Checks whether a block still exists and has a slot to hand out.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param key The first slot of the block, possibly of a block already freed.
+ * @return bool True if a node can be created in the block.
+ */
+template <typename T>
+bool DoublyLinked<T>::hasRoom(Node<T> *key) {
+    if (key == nullptr)
+        return false;
+
+    auto it = blocks.find(key);
+    return it != blocks.end() &&
+           (it->second.freeList != nullptr || it->second.bumped < it->second.capacity);
+}
+
+/**
+ * @brief Frees every pool block. All nodes must already be destroyed.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+void DoublyLinked<T>::releaseBlocks() {
+    for (auto &entry : blocks) {
+        ::operator delete(entry.first);
     }
-    newNode->prev = nullptr;
-    newNode->data = d;
-    newNode->next = nullptr;
-    return newNode;
+    blocks.clear();
+    partialBlocks.clear();
+    allocBlock = nullptr;
+}
+
+/**
+ * @brief Sets aside room for n more nodes in one block, so a list whose
+ * final length is known up front is built without growing the pool.
+ * Without a hint, each new block is as large as the list already is,
+ * capped at 4096 nodes.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param n Number of nodes to make room for.
+ */
+template <typename T>
+void DoublyLinked<T>::reserveNodes(int n) {
+    if (n <= 0)
+        return;
+
+    auto it = blocks.find(allocBlock);
+    if (it != blocks.end() && it->second.capacity - it->second.bumped >= static_cast<size_t>(n))
+        return;
+
+    addBlock(n);
+}
+
+/**
+ * @brief Points a node at a new successor and keeps the count of links
+ * that jump in memory up to date, so fragmentation() is O(1).
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param node The node whose next pointer changes.
+ * @param next The new successor, or nullptr.
+ */
+template <typename T>
+void DoublyLinked<T>::setNext(Node<T> *node, Node<T> *next) {
+    if (node->next != nullptr && node->next != node + 1)
+        jumps--;
+    node->next = next;
+    if (next != nullptr && next != node + 1)
+        jumps++;
 }
 
 /**
@@ -110,11 +324,13 @@ bool DoublyLinked<T>::deleteAfter(Node<T> *prevNode) {
     if (nodeDelete == nullptr)
         return false;
 
-    prevNode->next = nodeDelete->next;
+    setNext(prevNode, nodeDelete->next);
     if (nodeDelete->next != nullptr)
         nodeDelete->next->prev = prevNode;
+    else
+        tail = prevNode;
 
-    delete nodeDelete;
+    destroyNode(nodeDelete);
     count--;
     return true;
 }
@@ -135,8 +351,8 @@ void DoublyLinked<T>::insert_After(Node<T> *prevNode, T value) {
     Node<T> *nextNode = prevNode->next;
     Node<T>* newNode = createNewNode(value);
 
-    newNode->next = nextNode;
-    prevNode->next = newNode;
+    setNext(newNode, nextNode);
+    setNext(prevNode, newNode);
     newNode->prev = prevNode;
 
     if (nextNode != nullptr)
@@ -157,9 +373,10 @@ DoublyLinked<T>::~DoublyLinked() {
     Node<T> *tempPtr = nullptr;
     while (currentPtr != nullptr) {
         tempPtr = currentPtr->next;
-        delete currentPtr;
+        currentPtr->~Node<T>();
         currentPtr = tempPtr;
     }
+    releaseBlocks();
     head = nullptr;
     tail = nullptr;
     count = 0;
@@ -178,11 +395,39 @@ DoublyLinked<T>::DoublyLinked(const DoublyLinked &copyy) {
     tail = nullptr;
     count = 0;
 
+    reserveNodes(copyy.count);
+    Node<T> *current = copyy.head;
+    while (current != nullptr) {
+        push_back(current->data);
+        current = current->next;
+    }
+}
+
+/**
+ * @brief Copy assignment for DoublyLinked class.
+ * Replaces the contents with a deep copy of the provided list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param copyy The list to be copied.
+ * @return DoublyLinked& This list.
+ */
+template <typename T>
+DoublyLinked<T> &DoublyLinked<T>::operator=(const DoublyLinked &copyy) {
+    if (this == &copyy)
+        return *this;
+
+    T value;
+    while (pop_front(value)) {
+    }
+    releaseBlocks();
+
+    reserveNodes(copyy.count);
     Node<T> *current = copyy.head;
     while (current != nullptr) {
         push_back(current->data);
         current = current->next;
     }
+    return *this;
 }
 
 /**
@@ -196,7 +441,7 @@ void DoublyLinked<T>::push_front(T value) {
     Node<T>* newNode = createNewNode(value);
 
     if (head != nullptr) {
-        newNode->next = head;
+        setNext(newNode, head);
         head->prev = newNode;
         head = newNode;
     } else {
@@ -246,7 +491,7 @@ void DoublyLinked<T>::push_back(T value) {
     Node<T>* newNode = createNewNode(value);
 
     if (tail != nullptr) {
-        tail->next = newNode;
+        setNext(tail, newNode);
         newNode->prev = tail;
         tail = newNode;
     } else {
@@ -271,7 +516,7 @@ bool DoublyLinked<T>::pop_front(T &data) {
 
     data = head->data;
     if (head->next == nullptr) {
-        delete head;
+        destroyNode(head);
         tail = nullptr;
         head = nullptr;
         count = 0;
@@ -279,7 +524,7 @@ bool DoublyLinked<T>::pop_front(T &data) {
         Node<T> *prevHead = head;
         head = head->next;
         head->prev = nullptr;
-        delete prevHead;
+        destroyNode(prevHead);
         count--;
     }
 
@@ -300,15 +545,15 @@ bool DoublyLinked<T>::pop_back(T &data) {
 
     data = tail->data;
     if (head->next == nullptr) {
-        delete head;
+        destroyNode(head);
         tail = nullptr;
         head = nullptr;
         count = 0;
     } else {
         Node<T> *prevTail = tail;
         tail = tail->prev;
-        tail->next = nullptr;
-        delete prevTail;
+        setNext(tail, nullptr);
+        destroyNode(prevTail);
         count--;
     }
 
@@ -327,7 +572,12 @@ bool DoublyLinked<T>::deleteNode(int index) {
     if (index < 0 || index >= count || head == nullptr)
         return false;
 
-    if (index == 0 || index < count / 2) {
+    if (index == 0) {
+        T removed;
+        return pop_front(removed);
+    }
+
+    if (index < count / 2) {
         Node<T>* current = head;
 
         for (int i = 0; i < index - 1; ++i) {
@@ -374,6 +624,9 @@ bool DoublyLinked<T>::elementAt(int index, T &value) {
  */
 template <typename T>
 void DoublyLinked<T>::displayList() {
+    if (autoCompact)
+        maybeCompact(autoCompactThreshold);
+
     Node<T>* node = head;
     while (node != nullptr) {
         cout << node->data << "<==>";
@@ -412,7 +665,8 @@ bool DoublyLinked<T>::isEmpty() {
 }
 
 /**
- * @brief Reverses the order of elements in the list.
+ * @brief Reverses the order of elements in the list by swapping the links
+ * of every node; the data itself is never copied.
  * 
  * @tparam T The type of data stored in the list.
  * @return bool True if successful, false otherwise.
@@ -422,18 +676,24 @@ bool DoublyLinked<T>::reverseList() {
     if (count == 0 || head == nullptr)
         return false;
 
-    Node<T> *front = head;
-    Node<T> *back = tail;
+    Node<T> *current = head;
+    while (current != nullptr) {
+        Node<T> *nextNode = current->next;
+        current->next = current->prev;
+        current->prev = nextNode;
+        current = nextNode;
+    }
 
-    for (int i = 0; i < count / 2; i++) {
-        T temp = front->data;
-        front->data = back->data;
-        back->data = temp;
+    Node<T> *oldHead = head;
+    head = tail;
+    tail = oldHead;
 
-        front = front->next;
-        back = back->prev;
+    //Adjacency in memory is directional, so recount the jumps
+    jumps = 0;
+    for (current = head; current->next != nullptr; current = current->next) {
+        if (current->next != current + 1)
+            jumps++;
     }
-
     return true;
 }
 
@@ -453,19 +713,24 @@ void DoublyLinked<T>::deleteItem(T value) {
         if (current->data == value) {
             if (prevNode == nullptr) {
                 temp = current->next;
-                delete current;
+                destroyNode(current);
                 current = temp;
+                head = current;
                 if (current != nullptr) {
                     current->prev = nullptr;
                 }
             } else {
-                prevNode->next = current->next;
-                delete current;
+                setNext(prevNode, current->next);
+                destroyNode(current);
                 current = prevNode->next;
                 if (current != nullptr) {
                     current->prev = prevNode;
                 }
             }
+            if (current == nullptr) {
+                tail = prevNode;
+            }
+            count--;
         } else {
             prevNode = current;
             current = current->next;
@@ -482,6 +747,9 @@ void DoublyLinked<T>::deleteItem(T value) {
  */
 template <typename T>
 vector<Node<T>*> DoublyLinked<T>::searchItems(T value) {
+    if (autoCompact)
+        maybeCompact(autoCompactThreshold);
+
     vector<Node<T>*> nodes;
     Node<T> *current = head;
 
@@ -495,100 +763,2441 @@ vector<Node<T>*> DoublyLinked<T>::searchItems(T value) {
     return nodes;
 }
 
-#endif
+/**
+ * @brief Chaining operations shared by all list views. Each call wraps the
+ * view in another one; nothing is evaluated until it is iterated. Every
+ * view also has reversed(), which returns a view of the same type.
+ * 
+ * @tparam Derived The concrete view type.
+ */
+template <typename Derived>
+class ViewOps {
+public:
+    SliceView<Derived> slice(int from, int to) const {
+        return SliceView<Derived>(static_cast<const Derived &>(*this), from, to, false);
+    }
 
-// Class representing a Student
-class Student {
+    template <typename P>
+    FilterView<Derived, P> filter(P pred) const {
+        return FilterView<Derived, P>(static_cast<const Derived &>(*this), pred);
+    }
+};
+
+/**
+ * @brief View walking a DoublyLinked list in either direction. It keeps
+ * both ends of the chain, so flipping the direction is O(1).
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+class ListView : public ViewOps<ListView<T>> {
 private:
-    std::string name;
-    float gpa;
-    std::string address;
+    Node<T> *first;
+    Node<T> *last;
+    bool backward;
 
 public:
-    Student();
-    Student(std::string n, float g, std::string a);
-    Student(const Student &copyy);
-    std::string to_string() const;
-    bool operator==(const Student&) const;
-    friend std::ostream &operator<<(std::ostream &oo, const Student &student);
+    typedef T value_type;
+
+    class iterator {
+    private:
+        Node<T> *node;
+        bool backward;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        iterator(Node<T> *node, bool backward) : node(node), backward(backward) {}
+        T &operator*() const { return node->data; }
+        iterator &operator++() {
+            node = backward ? node->prev : node->next;
+            return *this;
+        }
+        bool operator==(const iterator &other) const { return node == other.node; }
+        bool operator!=(const iterator &other) const { return node != other.node; }
+    };
+
+    ListView(Node<T> *first, Node<T> *last, bool backward)
+        : first(first), last(last), backward(backward) {}
+
+    iterator begin() const { return iterator(first, backward); }
+    iterator end() const { return iterator(nullptr, backward); }
+
+    /**
+     * @brief Returns the same elements in the opposite order in O(1).
+     */
+    ListView reversed() const {
+        return ListView(last, first, !backward);
+    }
 };
 
-// Overloading the << operator for easy printing of Student objects
-std::ostream &operator<<(std::ostream &oo, const Student &student) {
-    oo << student.to_string();
-    return oo;
-}
+/**
+ * @brief View over the positions [from, to) of another view.
+ * 
+ * A reversed slice iterates the reversed source. Its positions are still
+ * counted from the original front, so when it is iterated it first counts
+ * the source once to find where the range starts. Creating it is O(1).
+ * 
+ * @tparam V The underlying view type.
+ */
+template <typename V>
+class SliceView : public ViewOps<SliceView<V>> {
+private:
+    V source;
+    int from;
+    int to;
+    bool fromBack;
 
-// Default constructor for Student
-Student::Student() : name(""), gpa(0.0), address("") {}
+public:
+    typedef typename V::value_type value_type;
+
+    class iterator {
+    private:
+        typename V::iterator current;
+        typename V::iterator stop;
+        int position;
+        int to;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename SliceView::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type *pointer;
+        typedef value_type &reference;
+
+        iterator(typename V::iterator current, typename V::iterator stop, int position, int to)
+            : current(current), stop(stop), position(position), to(to) {}
+        bool atEnd() const { return position >= to || current == stop; }
+        value_type &operator*() const { return *current; }
+        iterator &operator++() {
+            ++current;
+            ++position;
+            return *this;
+        }
+        bool operator==(const iterator &other) const {
+            if (atEnd() || other.atEnd())
+                return atEnd() == other.atEnd();
+            return current == other.current && position == other.position;
+        }
+        bool operator!=(const iterator &other) const { return !(*this == other); }
+    };
+
+    SliceView(const V &source, int from, int to, bool fromBack)
+        : source(source), from(from), to(to), fromBack(fromBack) {}
+
+    iterator begin() const {
+        int low = from;
+        int high = to;
+        if (fromBack) {
+            int length = 0;
+            for (typename V::iterator it = source.begin(); it != source.end(); ++it)
+                length++;
+            low = length - std::min(to, length);
+            high = length - std::min(from, length);
+        }
 
-// Parameterized constructor for Student
-Student::Student(std::string n, float g, std::string a) : name(n), gpa(g), address(a) {}
+        typename V::iterator current = source.begin();
+        typename V::iterator stop = source.end();
+        int position = 0;
+        while (position < low && current != stop) {
+            ++current;
+            ++position;
+        }
+        return iterator(current, stop, position, high);
+    }
 
-// Copy constructor for Student
-Student::Student(const Student &copyy) : name(copyy.name), gpa(copyy.gpa), address(copyy.address) {}
+    iterator end() const { return iterator(source.end(), source.end(), 0, 0); }
 
-// Converts Student object to a string
-std::string Student::to_string() const {
-    return "\nname: " + name + ", gpa: (" + std::to_string(gpa) + "), address: " + address;
+    /**
+     * @brief Returns the same positions in the opposite order.
+     */
+    SliceView reversed() const {
+        return SliceView(source.reversed(), from, to, !fromBack);
+    }
+};
+
+/**
+ * @brief View over the elements of another view matching a predicate.
+ * 
+ * @tparam V The underlying view type.
+ * @tparam P A callable taking an element and returning bool.
+ */
+template <typename V, typename P>
+class FilterView : public ViewOps<FilterView<V, P>> {
+private:
+    V source;
+    P pred;
+
+public:
+    typedef typename V::value_type value_type;
+
+    class iterator {
+    private:
+        typename V::iterator current;
+        typename V::iterator stop;
+        const P *pred;
+
+        void skip() {
+            while (current != stop && !(*pred)(*current))
+                ++current;
+        }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename FilterView::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type *pointer;
+        typedef value_type &reference;
+
+        iterator(typename V::iterator current, typename V::iterator stop, const P *pred)
+            : current(current), stop(stop), pred(pred) {
+            skip();
+        }
+        value_type &operator*() const { return *current; }
+        iterator &operator++() {
+            ++current;
+            skip();
+            return *this;
+        }
+        bool operator==(const iterator &other) const { return current == other.current; }
+        bool operator!=(const iterator &other) const { return current != other.current; }
+    };
+
+    FilterView(const V &source, P pred) : source(source), pred(pred) {}
+
+    iterator begin() const { return iterator(source.begin(), source.end(), &pred); }
+    iterator end() const { return iterator(source.end(), source.end(), &pred); }
+
+    /**
+     * @brief Returns the matching elements in the opposite order; O(1)
+     * whenever the source reverses in O(1).
+     */
+    FilterView reversed() const {
+        return FilterView(source.reversed(), pred);
+    }
+};
+
+/**
+ * @brief Returns a view of the list from front to back.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return ListView<T> A view starting at the head.
+ */
+template <typename T>
+ListView<T> DoublyLinked<T>::view() {
+    return ListView<T>(head, tail, false);
 }
 
-// Overloading the == operator for Student
-bool Student::operator==(const Student &copyy) const {
-    return (name == copyy.name && gpa == copyy.gpa && address == copyy.address);
+/**
+ * @brief Returns a view of the list from back to front in O(1).
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return ListView<T> A view starting at the tail.
+ */
+template <typename T>
+ListView<T> DoublyLinked<T>::reversed() {
+    return ListView<T>(tail, head, true);
 }
 
-// Main function
-int main() {
-    //Creating a doubly linked list of Students 
-    DoublyLinked<Student> studVector;
-    //Adding students to the list 
-    Student student1("student1", 4.0, "address1");
-    studVector.push_back(student1);
-    //Likewise for other students 
-    Student student2("student2", 4.0, "address2");
-    studVector.push_back(student2);
-    Student student3("student3", 4.0, "address3");
-    studVector.push_back(student3);
-    Student student4("student4", 4.0, "address4");
-    studVector.push_back(student4);
-    Student student5("student5", 4.0, "address5");
-    studVector.push_back(student5);
-    Student student6("student6", 4.0, "address6");
-    studVector.push_back(student6);
-    Student student7("student7", 4.0, "address7");
-    studVector.push_back(student7);
-    Student student8("student8", 4.0, "address8");
-    studVector.push_back(student8);
-    Student student9("student9", 4.0, "address9");
-    studVector.push_back(student9);
-    Student student10("student10", 4.0, "address10");
-    studVector.push_back(student10);
-    studVector.displayList();
-    cout << endl;
+/**
+ * @brief Returns a view of the positions [from, to) of the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param from First position included.
+ * @param to First position excluded.
+ */
+template <typename T>
+SliceView<ListView<T>> DoublyLinked<T>::slice(int from, int to) {
+    return view().slice(from, to);
+}
 
-    //Creating a copy of the list using the copy constructor 
-    DoublyLinked<Student> cpStudVector = studVector;
-    cpStudVector.displayList();
-    cout << endl << endl;
+/**
+ * @brief Returns a view of the elements for which pred returns true.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param pred A callable taking an element and returning bool.
+ */
+template <typename T>
+template <typename P>
+FilterView<ListView<T>, P> DoublyLinked<T>::filter(P pred) {
+    return view().filter(pred);
+}
 
-    //Reversing the original list 
-    studVector.reverseList();
-    studVector.displayList();
-    cout << endl << endl;
+/**
+ * @brief Returns the first node of the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return Node<T>* The head node, or nullptr if the list is empty.
+ */
+template <typename T>
+Node<T>* DoublyLinked<T>::frontNode() {
+    return head;
+}
 
-    //Searching for students with a specific value and printing them 
-    Student stObj("student5", 4.0, "address5");
-    vector<Node<Student>*> nodes = studVector.searchItems(stObj);
+/**
+ * @brief Returns the last node of the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return Node<T>* The tail node, or nullptr if the list is empty.
+ */
+template <typename T>
+Node<T>* DoublyLinked<T>::backNode() {
+    return tail;
+}
 
-    for (const auto& node : nodes) {
-        cout << node->data << " ";
+/**
+ * @brief Relinks a node of this list to the front without copying its data.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param node A node belonging to this list.
+ */
+template <typename T>
+void DoublyLinked<T>::moveToFront(Node<T> *node) {
+    if (node == nullptr) {
+        throw std::invalid_argument("Node is required, it cannot be NULL");
     }
-    cout << endl << endl;
+    if (node == head)
+        return;
+
+    setNext(node->prev, node->next);
+    if (node->next != nullptr)
+        node->next->prev = node->prev;
+    else
+        tail = node->prev;
+
+    node->prev = nullptr;
+    setNext(node, head);
+    head->prev = node;
+    head = node;
+}
 
-    //Deleting a note at a specific index and displaying the updated list
-    studVector.deleteNode(7);
-    studVector.displayList();
+/**
+ * @brief Unlinks and deletes a node of this list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param node A node belonging to this list.
+ */
+template <typename T>
+void DoublyLinked<T>::removeNode(Node<T> *node) {
+    if (node == nullptr) {
+        throw std::invalid_argument("Node is required, it cannot be NULL");
+    }
+
+    if (node->prev != nullptr)
+        setNext(node->prev, node->next);
+    else
+        head = node->next;
+
+    if (node->next != nullptr)
+        node->next->prev = node->prev;
+    else
+        tail = node->prev;
+
+    destroyNode(node);
+    count--;
+}
+
+/**
+ * @brief Measures how scattered the nodes are in memory, in O(1) from the
+ * jump count maintained as links change.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return double The fraction of links whose next node is not the adjacent
+ * slot in memory: 0 for a freshly compacted list, close to 1 when nodes are
+ * in random order.
+ */
+template <typename T>
+double DoublyLinked<T>::fragmentation() {
+    return count < 2 ? 0.0 : static_cast<double>(jumps) / (count - 1);
+}
+
+/**
+ * @brief Relocates all nodes into one contiguous block in list order and
+ * frees the old blocks. Pointers to nodes (e.g. from searchItems) are
+ * invalidated. If copying an element throws, the list is left untouched.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+void DoublyLinked<T>::compact() {
+    if (count == 0)
+        return;
+
+    //Build the whole new chain first; elements are moved only when that
+    //cannot throw, so the old chain stays intact until it is complete
+    Node<T> *block = static_cast<Node<T>*>(::operator new(count * sizeof(Node<T>)));
+    Node<T> *prevNew = nullptr;
+    int built = 0;
+    std::map<Node<T>*, PoolBlock> compacted;
+    try {
+        for (Node<T> *current = head; current != nullptr; current = current->next) {
+            Node<T> *slot = block + built;
+            new (slot) Node<T>{prevNew, std::move_if_noexcept(current->data), nullptr};
+            if (prevNew != nullptr)
+                prevNew->next = slot;
+            prevNew = slot;
+            built++;
+        }
+        compacted.emplace(block, PoolBlock{static_cast<size_t>(count), static_cast<size_t>(count),
+                                           static_cast<size_t>(count), nullptr});
+    } catch (...) {
+        for (int i = 0; i < built; i++)
+            block[i].~Node<T>();
+        ::operator delete(block);
+        throw;
+    }
+
+    Node<T> *current = head;
+    while (current != nullptr) {
+        Node<T> *nextOld = current->next;
+        current->~Node<T>();
+        current = nextOld;
+    }
+    releaseBlocks();
+
+    blocks.swap(compacted);
+    head = block;
+    tail = prevNew;
+    jumps = 0;
+}
+
+/**
+ * @brief Compacts the list if its fragmentation exceeds a threshold.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param threshold Fragmentation above which to compact, between 0 and 1.
+ * @return bool True if the list was compacted, false otherwise.
+ */
+template <typename T>
+bool DoublyLinked<T>::maybeCompact(double threshold) {
+    if (fragmentation() <= threshold)
+        return false;
+
+    compact();
+    return true;
+}
+
+/**
+ * @brief Makes displayList and searchItems compact the list first whenever
+ * its fragmentation exceeds the threshold. Off by default, since it
+ * invalidates node pointers held elsewhere.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param enabled Whether to compact automatically.
+ * @param threshold Fragmentation above which to compact, between 0 and 1.
+ */
+template <typename T>
+void DoublyLinked<T>::setAutoCompact(bool enabled, double threshold) {
+    autoCompact = enabled;
+    autoCompactThreshold = threshold;
+}
+
+/**
+ * @brief Least-recently-used cache on top of DoublyLinked.
+ * 
+ * The list keeps entries in recency order (front is most recent) and a hash
+ * map points each key at its node, so get, put, move-to-front and eviction
+ * of the tail are all O(1). Capacity is counted in entries, or in whatever
+ * unit the optional weigher returns (e.g. bytes).
+ * 
+ * @tparam K The key type.
+ * @tparam V The value type.
+ */
+template <typename K, typename V>
+class LruCache {
+public:
+    typedef std::function<size_t(const K&, const V&)> Weigher;
+
+private:
+    typedef std::pair<K, V> Entry;
+
+    DoublyLinked<Entry> recency;
+    std::unordered_map<K, Node<Entry>*> index;
+    Weigher weigher;
+    size_t capacity;
+    size_t used = 0;
+    size_t hitCount = 0;
+    size_t missCount = 0;
+    size_t evictionCount = 0;
+
+    size_t weightOf(const K &key, const V &value) const;
+    void dropNode(Node<Entry> *node);
+
+public:
+    explicit LruCache(size_t capacity, Weigher weigher = nullptr);
+
+    //The index holds node pointers into recency, so the cache is not copyable
+    LruCache(const LruCache &) = delete;
+    LruCache &operator=(const LruCache &) = delete;
+
+    bool get(const K &key, V &value);
+    void put(const K &key, V value);
+    bool erase(const K &key);
+    size_t size() const;
+    size_t weight() const;
+    size_t hits() const;
+    size_t misses() const;
+    size_t evictions() const;
+};
+
+/**
+ * @brief Constructor for LruCache.
+ * 
+ * @param capacity Maximum total weight held by the cache.
+ * @param weigher Weight of one entry; every entry weighs 1 when empty.
+ */
+template <typename K, typename V>
+LruCache<K, V>::LruCache(size_t capacity, Weigher weigher)
+    : weigher(weigher), capacity(capacity) {}
+
+/**
+ * @brief Computes the weight charged against the capacity for an entry.
+ */
+template <typename K, typename V>
+size_t LruCache<K, V>::weightOf(const K &key, const V &value) const {
+    return weigher ? weigher(key, value) : 1;
+}
+
+/**
+ * @brief Removes a node from both the index and the recency list.
+ */
+template <typename K, typename V>
+void LruCache<K, V>::dropNode(Node<Entry> *node) {
+    used -= weightOf(node->data.first, node->data.second);
+    index.erase(node->data.first);
+    recency.removeNode(node);
+}
+
+/**
+ * @brief Looks up a key and marks it most recently used.
+ * 
+ * @param key The key to look up.
+ * @param value Reference to store the cached value.
+ * @return bool True on a hit, false on a miss.
+ */
+template <typename K, typename V>
+bool LruCache<K, V>::get(const K &key, V &value) {
+    auto found = index.find(key);
+    if (found == index.end()) {
+        missCount++;
+        return false;
+    }
+
+    hitCount++;
+    recency.moveToFront(found->second);
+    value = found->second->data.second;
+    return true;
+}
+
+/**
+ * @brief Inserts or replaces a key, then evicts from the tail until the
+ * cache fits its capacity. An entry heavier than the whole capacity is not
+ * cached.
+ * 
+ * @param key The key to store.
+ * @param value The value to store.
+ */
+template <typename K, typename V>
+void LruCache<K, V>::put(const K &key, V value) {
+    auto found = index.find(key);
+    if (found != index.end())
+        dropNode(found->second);
+
+    size_t entryWeight = weightOf(key, value);
+    if (entryWeight > capacity)
+        return;
+
+    recency.push_front(Entry(key, std::move(value)));
+    index[key] = recency.frontNode();
+    used += entryWeight;
+
+    while (used > capacity) {
+        dropNode(recency.backNode());
+        evictionCount++;
+    }
+}
+
+/**
+ * @brief Removes a key from the cache.
+ * 
+ * @return bool True if the key was cached, false otherwise.
+ */
+template <typename K, typename V>
+bool LruCache<K, V>::erase(const K &key) {
+    auto found = index.find(key);
+    if (found == index.end())
+        return false;
+
+    dropNode(found->second);
+    return true;
+}
+
+template <typename K, typename V>
+size_t LruCache<K, V>::size() const {
+    return index.size();
+}
+
+template <typename K, typename V>
+size_t LruCache<K, V>::weight() const {
+    return used;
+}
+
+template <typename K, typename V>
+size_t LruCache<K, V>::hits() const {
+    return hitCount;
+}
+
+template <typename K, typename V>
+size_t LruCache<K, V>::misses() const {
+    return missCount;
+}
+
+template <typename K, typename V>
+size_t LruCache<K, V>::evictions() const {
+    return evictionCount;
+}
+
+/**
+ * @brief Thread-safe front end splitting keys across independently locked
+ * LruCache shards, so threads touching different shards do not contend.
+ * Recency is tracked per shard.
+ * 
+ * @tparam K The key type.
+ * @tparam V The value type.
+ */
+template <typename K, typename V>
+class ShardedLruCache {
+private:
+    struct Shard {
+        std::mutex lock;
+        LruCache<K, V> cache;
+
+        Shard(size_t capacity, typename LruCache<K, V>::Weigher weigher)
+            : cache(capacity, weigher) {}
+    };
+
+    vector<std::unique_ptr<Shard>> shards;
+
+    Shard &shardFor(const K &key);
+    size_t sum(size_t (LruCache<K, V>::*counter)() const);
+
+public:
+    ShardedLruCache(size_t capacity, size_t shardCount,
+                    typename LruCache<K, V>::Weigher weigher = nullptr);
+
+    bool get(const K &key, V &value);
+    void put(const K &key, V value);
+    bool erase(const K &key);
+    size_t size();
+    size_t hits();
+    size_t misses();
+    size_t evictions();
+};
+
+/**
+ * @brief Constructor for ShardedLruCache.
+ * 
+ * @param capacity Total capacity, split evenly (rounded up) across shards.
+ * @param shardCount Number of independently locked shards.
+ * @param weigher Weight of one entry; every entry weighs 1 when empty.
+ */
+template <typename K, typename V>
+ShardedLruCache<K, V>::ShardedLruCache(size_t capacity, size_t shardCount,
+                                       typename LruCache<K, V>::Weigher weigher) {
+    if (shardCount == 0) {
+        throw std::invalid_argument("ShardedLruCache needs at least one shard");
+    }
+    size_t perShard = (capacity + shardCount - 1) / shardCount;
+    for (size_t i = 0; i < shardCount; i++) {
+        shards.push_back(std::unique_ptr<Shard>(new Shard(perShard, weigher)));
+    }
+}
+
+template <typename K, typename V>
+typename ShardedLruCache<K, V>::Shard &ShardedLruCache<K, V>::shardFor(const K &key) {
+    return *shards[std::hash<K>()(key) % shards.size()];
+}
+
+template <typename K, typename V>
+size_t ShardedLruCache<K, V>::sum(size_t (LruCache<K, V>::*counter)() const) {
+    size_t total = 0;
+    for (auto &shard : shards) {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        total += (shard->cache.*counter)();
+    }
+    return total;
+}
+
+template <typename K, typename V>
+bool ShardedLruCache<K, V>::get(const K &key, V &value) {
+    Shard &shard = shardFor(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.cache.get(key, value);
+}
+
+template <typename K, typename V>
+void ShardedLruCache<K, V>::put(const K &key, V value) {
+    Shard &shard = shardFor(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    shard.cache.put(key, std::move(value));
+}
+
+template <typename K, typename V>
+bool ShardedLruCache<K, V>::erase(const K &key) {
+    Shard &shard = shardFor(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.cache.erase(key);
+}
+
+template <typename K, typename V>
+size_t ShardedLruCache<K, V>::size() {
+    return sum(&LruCache<K, V>::size);
+}
+
+template <typename K, typename V>
+size_t ShardedLruCache<K, V>::hits() {
+    return sum(&LruCache<K, V>::hits);
+}
+
+template <typename K, typename V>
+size_t ShardedLruCache<K, V>::misses() {
+    return sum(&LruCache<K, V>::misses);
+}
+
+template <typename K, typename V>
+size_t ShardedLruCache<K, V>::evictions() {
+    return sum(&LruCache<K, V>::evictions);
+}
+
+/**
+ * @brief Copy-on-write doubly linked list.
+ * 
+ * Elements are kept in a chain of DoublyLinked segments of bounded length.
+ * Both the segment table and each segment are reference counted, so copying
+ * the list is O(1). The first mutation of a shared copy clones the table
+ * (one pointer per segment) and then only the segment it modifies; all
+ * other segments stay shared with the other copies.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+class CowDoublyLinked {
+private:
+    typedef DoublyLinked<T> Segment;
+
+    struct SegmentRef {
+        std::shared_ptr<Segment> segment;
+        int length;
+    };
+
+    typedef vector<SegmentRef> SegmentTable;
+
+    std::shared_ptr<SegmentTable> table;
+    int count = 0;
+    int segmentLength;
+
+    SegmentTable &detachTable();
+    std::shared_ptr<Segment> newSegment() const;
+    Segment &detachSegment(size_t position);
+    bool locate(int index, size_t &position, int &offset) const;
+    void splitSegment(size_t position);
+    void dropIfEmpty(size_t position);
+
+public:
+    explicit CowDoublyLinked(int segmentLength = 64);
+
+    void push_front(T value);
+    bool insert(int index, T value);
+    void push_back(T value);
+    bool pop_front(T &data);
+    bool pop_back(T &data);
+    bool deleteNode(int index);
+    bool elementAt(int index, T &value) const;
+    void displayList() const;
+    int size() const;
+    bool isEmpty() const;
+    bool sharesStorageWith(const CowDoublyLinked &other) const;
+};
+
+/**
+ * @brief Constructor for CowDoublyLinked class.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param segmentLength Number of elements per segment, i.e. the most that a
+ * single write to a shared list has to copy.
+ */
+template <typename T>
+CowDoublyLinked<T>::CowDoublyLinked(int segmentLength)
+    : table(std::make_shared<SegmentTable>()), segmentLength(segmentLength) {
+    if (segmentLength <= 0) {
+        throw std::invalid_argument("Segment length must be positive");
+    }
+}
+
+/**
+ * @brief Gives this list its own segment table if it is shared.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return SegmentTable& The table, owned by this list only.
+ */
+template <typename T>
+typename CowDoublyLinked<T>::SegmentTable &CowDoublyLinked<T>::detachTable() {
+    if (table.use_count() > 1)
+        table = std::make_shared<SegmentTable>(*table);
+    return *table;
+}
+
+/**
+ * @brief Creates an empty segment whose node pool holds segmentLength
+ * elements, so a full segment never allocates more than it needs.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return std::shared_ptr<Segment> The new segment.
+ */
+template <typename T>
+std::shared_ptr<typename CowDoublyLinked<T>::Segment> CowDoublyLinked<T>::newSegment() const {
+    std::shared_ptr<Segment> segment = std::make_shared<Segment>();
+    segment->reserveNodes(segmentLength);
+    return segment;
+}
+
+/**
+ * @brief Gives this list its own copy of one segment if it is shared.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param position Position of the segment in the table.
+ * @return Segment& The segment, owned by this list only.
+ */
+template <typename T>
+typename CowDoublyLinked<T>::Segment &CowDoublyLinked<T>::detachSegment(size_t position) {
+    SegmentRef &ref = detachTable()[position];
+    if (ref.segment.use_count() > 1)
+        ref.segment = std::make_shared<Segment>(*ref.segment);
+    return *ref.segment;
+}
+
+/**
+ * @brief Finds the segment holding an index and the offset inside it.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return bool True if the index is in range, false otherwise.
+ */
+template <typename T>
+bool CowDoublyLinked<T>::locate(int index, size_t &position, int &offset) const {
+    if (index < 0 || index >= count)
+        return false;
+
+    position = 0;
+    while (index >= (*table)[position].length) {
+        index -= (*table)[position].length;
+        position++;
+    }
+    offset = index;
+    return true;
+}
+
+/**
+ * @brief Splits a detached segment in two once it grows past twice the
+ * segment length, so later copies stay bounded.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param position Position of the segment in the table.
+ */
+template <typename T>
+void CowDoublyLinked<T>::splitSegment(size_t position) {
+    SegmentTable &segments = *table;
+    if (segments[position].length < 2 * segmentLength)
+        return;
+
+    std::shared_ptr<Segment> upper = newSegment();
+    T value;
+    for (int i = 0; i < segmentLength; i++) {
+        segments[position].segment->pop_back(value);
+        upper->push_front(value);
+    }
+    segments[position].length -= segmentLength;
+    segments.insert(segments.begin() + position + 1, SegmentRef{upper, segmentLength});
+}
+
+/**
+ * @brief Removes a segment from the table once it holds no elements.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param position Position of the segment in the table.
+ */
+template <typename T>
+void CowDoublyLinked<T>::dropIfEmpty(size_t position) {
+    if ((*table)[position].length == 0)
+        table->erase(table->begin() + position);
+}
+
+/**
+ * @brief Adds a value to the front of the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param value The value to be added.
+ */
+template <typename T>
+void CowDoublyLinked<T>::push_front(T value) {
+    SegmentTable &segments = detachTable();
+    if (segments.empty() || segments.front().length >= segmentLength)
+        segments.insert(segments.begin(), SegmentRef{newSegment(), 0});
+
+    detachSegment(0).push_front(value);
+    segments.front().length++;
+    count++;
+}
+
+/**
+ * @brief Inserts a value at the specified index.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param index The index at which the value should be inserted.
+ * @param value The value to be inserted.
+ * @return bool True if insertion is successful, false otherwise.
+ */
+template <typename T>
+bool CowDoublyLinked<T>::insert(int index, T value) {
+    if (index < 0 || index > count)
+        return false;
+
+    if (index == 0) {
+        push_front(value);
+    } else if (index == count) {
+        push_back(value);
+    } else {
+        size_t position;
+        int offset;
+        locate(index, position, offset);
+        detachSegment(position).insert(offset, value);
+        (*table)[position].length++;
+        count++;
+        splitSegment(position);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Adds a value to the end of the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param value The value to be added.
+ */
+template <typename T>
+void CowDoublyLinked<T>::push_back(T value) {
+    SegmentTable &segments = detachTable();
+    if (segments.empty() || segments.back().length >= segmentLength)
+        segments.push_back(SegmentRef{newSegment(), 0});
+
+    detachSegment(segments.size() - 1).push_back(value);
+    segments.back().length++;
+    count++;
+}
+
+/**
+ * @brief Removes and returns the first value in the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param data Reference to store the retrieved data.
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T>
+bool CowDoublyLinked<T>::pop_front(T &data) {
+    if (count == 0)
+        return false;
+
+    detachSegment(0).pop_front(data);
+    (*table)[0].length--;
+    count--;
+    dropIfEmpty(0);
+    return true;
+}
+
+/**
+ * @brief Removes and returns the last value in the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param data Reference to store the retrieved data.
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T>
+bool CowDoublyLinked<T>::pop_back(T &data) {
+    if (count == 0)
+        return false;
+
+    size_t last = table->size() - 1;
+    detachSegment(last).pop_back(data);
+    (*table)[last].length--;
+    count--;
+    dropIfEmpty(last);
+    return true;
+}
+
+/**
+ * @brief Deletes the value at the specified index.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param index The index of the value to be deleted.
+ * @return bool True if deletion is successful, false otherwise.
+ */
+template <typename T>
+bool CowDoublyLinked<T>::deleteNode(int index) {
+    size_t position;
+    int offset;
+    if (!locate(index, position, offset))
+        return false;
+
+    detachSegment(position).deleteNode(offset);
+    (*table)[position].length--;
+    count--;
+    dropIfEmpty(position);
+    return true;
+}
+
+/**
+ * @brief Retrieves the value at the specified index without detaching.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param index The index of the value to be retrieved.
+ * @param value Reference to store the retrieved value.
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T>
+bool CowDoublyLinked<T>::elementAt(int index, T &value) const {
+    size_t position;
+    int offset;
+    if (!locate(index, position, offset))
+        return false;
+
+    return (*table)[position].segment->elementAt(offset, value);
+}
+
+/**
+ * @brief Displays the elements of the list.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+void CowDoublyLinked<T>::displayList() const {
+    for (const SegmentRef &ref : *table) {
+        Node<T> *node = ref.segment->frontNode();
+        while (node != nullptr) {
+            cout << node->data << "<==>";
+            node = node->next;
+        }
+    }
+    cout << "BEGIN";
+}
+
+template <typename T>
+int CowDoublyLinked<T>::size() const {
+    return count;
+}
+
+template <typename T>
+bool CowDoublyLinked<T>::isEmpty() const {
+    return count == 0;
+}
+
+/**
+ * @brief Checks whether two lists still share any segment.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return bool True if at least one segment is shared, false otherwise.
+ */
+template <typename T>
+bool CowDoublyLinked<T>::sharesStorageWith(const CowDoublyLinked &other) const {
+    for (const SegmentRef &mine : *table) {
+        for (const SegmentRef &theirs : *other.table) {
+            if (mine.segment == theirs.segment)
+                return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Serializes list elements to and from a spill file.
+ * 
+ * The default handles trivially copyable types byte for byte; other types
+ * need a specialization with the same two functions.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+struct SpillCodec {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SpillCodec must be specialized for non-trivially-copyable types");
+
+    static void write(std::ostream &out, const T &value) {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    static bool read(std::istream &in, T &value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+};
+
+/**
+ * @brief Settings for SpillingDoublyLinked. Each resident block holds
+ * blockLength * sizeof(Node<T>) bytes of nodes, so the list keeps at most
+ * residentBlocks times that in memory (see budgetBytes()), plus any heap
+ * memory owned by the elements and the blocks a scan decodes ahead.
+ */
+struct SpillConfig {
+    std::string path;          //Backing file, created and removed by the list
+    int blockLength = 4096;    //Elements per block
+    int residentBlocks = 8;    //Memory budget in blocks, at least 2
+    int readAheadBlocks = 2;   //Spilled blocks decoded ahead of a scan; 0 reads inline
+};
+
+/**
+ * @brief Reads and decodes one spilled block from a stream.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param in The stream holding the spill file.
+ * @param offset Position of the block in the file.
+ * @param length Number of elements in the block.
+ * @return vector<T> The decoded elements.
+ */
+template <typename T>
+vector<T> readSpilledBlock(std::istream &in, std::streamoff offset, int length) {
+    in.seekg(offset);
+    vector<T> values(length);
+    for (int i = 0; i < length; i++) {
+        if (!SpillCodec<T>::read(in, values[i])) {
+            throw std::runtime_error("Cannot read spill file");
+        }
+    }
+    return values;
+}
+
+/**
+ * @brief Read-ahead for one scan of a SpillingDoublyLinked.
+ * 
+ * A single worker thread reads the scan's spilled blocks in visit order
+ * through one stream. It keeps at most depth decoded blocks waiting, so a
+ * scan costs one thread and one open() however many blocks it reads.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+class SpillPrefetcher {
+public:
+    typedef std::pair<std::streamoff, int> Extent;
+
+private:
+    std::ifstream in;
+    vector<Extent> extents;
+    size_t depth;
+    std::deque<vector<T>> ready;
+    std::exception_ptr failure;
+    bool stopping = false;
+    std::mutex lock;
+    std::condition_variable changed;
+    std::thread worker;
+
+    void run();
+
+public:
+    SpillPrefetcher(const std::string &path, vector<Extent> extents, size_t depth);
+    ~SpillPrefetcher();
+
+    SpillPrefetcher(const SpillPrefetcher &) = delete;
+    SpillPrefetcher &operator=(const SpillPrefetcher &) = delete;
+
+    vector<T> next();
+};
+
+/**
+ * @brief Opens the spill file and starts the reader thread.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param path The spill file; it must be flushed already.
+ * @param extents Offset and length of each block, in visit order.
+ * @param depth Most decoded blocks held ahead of the visitor.
+ */
+template <typename T>
+SpillPrefetcher<T>::SpillPrefetcher(const std::string &path, vector<Extent> extents, size_t depth)
+    : in(path, std::ios::binary), extents(std::move(extents)), depth(depth) {
+    if (!in) {
+        throw std::runtime_error("Cannot open spill file " + path);
+    }
+    worker = std::thread(&SpillPrefetcher::run, this);
+}
+
+/**
+ * @brief Stops the reader, even if the scan ended early, and joins it.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+SpillPrefetcher<T>::~SpillPrefetcher() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    changed.notify_all();
+    worker.join();
+}
+
+/**
+ * @brief Reader loop: decodes blocks in order, waiting while depth blocks
+ * are already queued.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+void SpillPrefetcher<T>::run() {
+    try {
+        for (const Extent &extent : extents) {
+            vector<T> values = readSpilledBlock<T>(in, extent.first, extent.second);
+            std::unique_lock<std::mutex> guard(lock);
+            changed.wait(guard, [this] { return stopping || ready.size() < depth; });
+            if (stopping)
+                return;
+            ready.push_back(std::move(values));
+            changed.notify_all();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> guard(lock);
+        failure = std::current_exception();
+        changed.notify_all();
+    }
+}
+
+/**
+ * @brief Returns the next block in visit order, waiting for the reader.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @return vector<T> The decoded elements of the block.
+ */
+template <typename T>
+vector<T> SpillPrefetcher<T>::next() {
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait(guard, [this] { return !ready.empty() || failure; });
+    if (ready.empty())
+        std::rethrow_exception(failure);
+
+    vector<T> values = std::move(ready.front());
+    ready.pop_front();
+    changed.notify_all();
+    return values;
+}
+
+/**
+ * @brief Doubly linked list that can grow past available memory.
+ * 
+ * Elements are grouped into blocks of blockLength. A run of blocks at the
+ * head and a run at the tail stay in memory as DoublyLinked segments; the
+ * blocks between them are serialized to the spill file. At most
+ * residentBlocks blocks are held at once, so push_back/pop_front streams
+ * keep a bounded resident set. Space of reloaded blocks is reused for
+ * later spills.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+class SpillingDoublyLinked {
+private:
+    struct Block {
+        std::unique_ptr<DoublyLinked<T>> nodes;  //nullptr while spilled
+        int length = 0;
+        std::streamoff offset = 0;
+        std::streamsize bytes = 0;
+    };
+
+    SpillConfig config;
+    std::deque<Block> blocks;
+    size_t headResident = 0;
+    size_t tailResident = 0;
+    size_t count = 0;
+    std::fstream file;
+    std::streamoff fileEnd = 0;
+    std::multimap<std::streamsize, std::streamoff> freeExtents;
+
+    void spill(size_t position);
+    void load(size_t position);
+    void enforceBudget();
+    template <typename F>
+    void scan(F fn, bool backward);
+
+public:
+    explicit SpillingDoublyLinked(const SpillConfig &config);
+    ~SpillingDoublyLinked();
+
+    SpillingDoublyLinked(const SpillingDoublyLinked &) = delete;
+    SpillingDoublyLinked &operator=(const SpillingDoublyLinked &) = delete;
+
+    void push_back(T value);
+    bool pop_front(T &data);
+    size_t size() const;
+    bool isEmpty() const;
+    size_t residentElements() const;
+    size_t budgetBytes() const;
+
+    template <typename F>
+    void forEachForward(F fn);
+    template <typename F>
+    void forEachBackward(F fn);
+};
+
+/**
+ * @brief Constructor for SpillingDoublyLinked class.
+ * Creates (or truncates) the spill file.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param config Block size, memory budget, read-ahead and file path.
+ */
+template <typename T>
+SpillingDoublyLinked<T>::SpillingDoublyLinked(const SpillConfig &config) : config(config) {
+    if (config.blockLength <= 0 || config.residentBlocks < 2 || config.readAheadBlocks < 0) {
+        throw std::invalid_argument("SpillConfig needs blockLength > 0 and residentBlocks >= 2");
+    }
+    file.open(config.path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Cannot open spill file " + config.path);
+    }
+}
+
+/**
+ * @brief Destructor for SpillingDoublyLinked class.
+ * Frees the resident blocks and deletes the spill file.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+SpillingDoublyLinked<T>::~SpillingDoublyLinked() {
+    file.close();
+    std::remove(config.path.c_str());
+}
+
+/**
+ * @brief Writes a resident block to the spill file and frees its nodes.
+ * Reuses the smallest free extent that fits, otherwise appends.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param position Position of the block.
+ */
+template <typename T>
+void SpillingDoublyLinked<T>::spill(size_t position) {
+    Block &block = blocks[position];
+    std::ostringstream buffer(std::ios::binary);
+    for (const T &value : block.nodes->view()) {
+        SpillCodec<T>::write(buffer, value);
+    }
+    const std::string bytes = buffer.str();
+
+    block.bytes = static_cast<std::streamsize>(bytes.size());
+    auto extent = freeExtents.lower_bound(block.bytes);
+    if (extent != freeExtents.end()) {
+        block.offset = extent->second;
+        std::streamsize leftover = extent->first - block.bytes;
+        freeExtents.erase(extent);
+        if (leftover > 0)
+            freeExtents.emplace(leftover, block.offset + block.bytes);
+    } else {
+        block.offset = fileEnd;
+        fileEnd += block.bytes;
+    }
+
+    file.seekp(block.offset);
+    file.write(bytes.data(), block.bytes);
+    if (!file) {
+        throw std::runtime_error("Cannot write spill file " + config.path);
+    }
+    block.nodes.reset();
+}
+
+/**
+ * @brief Reads a spilled block back into memory and frees its extent.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param position Position of the block.
+ */
+template <typename T>
+void SpillingDoublyLinked<T>::load(size_t position) {
+    Block &block = blocks[position];
+    block.nodes.reset(new DoublyLinked<T>());
+    block.nodes->reserveNodes(block.length);
+
+    file.seekg(block.offset);
+    T value;
+    for (int i = 0; i < block.length; i++) {
+        if (!SpillCodec<T>::read(file, value)) {
+            throw std::runtime_error("Cannot read spill file " + config.path);
+        }
+        block.nodes->push_back(value);
+    }
+
+    freeExtents.emplace(block.bytes, block.offset);
+    if (headResident + tailResident + 1 >= blocks.size()) {
+        //Nothing else is on disk, so the whole file is free again
+        freeExtents.clear();
+        fileEnd = 0;
+    }
+}
+
+/**
+ * @brief Spills blocks next to the spilled middle until the resident blocks
+ * fit the budget, taking from whichever hot run is longer.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+void SpillingDoublyLinked<T>::enforceBudget() {
+    size_t budget = static_cast<size_t>(config.residentBlocks);
+    while (headResident + tailResident > budget) {
+        if (tailResident > 1 && (tailResident >= headResident || headResident <= 1)) {
+            spill(blocks.size() - tailResident);
+            tailResident--;
+        } else {
+            spill(headResident - 1);
+            headResident--;
+        }
+    }
+}
+
+/**
+ * @brief Adds a value to the end of the list, spilling a cold block if the
+ * memory budget is exceeded.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param value The value to be added.
+ */
+template <typename T>
+void SpillingDoublyLinked<T>::push_back(T value) {
+    if (blocks.empty() || blocks.back().length >= config.blockLength) {
+        blocks.emplace_back();
+        blocks.back().nodes.reset(new DoublyLinked<T>());
+        blocks.back().nodes->reserveNodes(config.blockLength);
+        if (blocks.size() == 1)
+            headResident = 1;
+        else
+            tailResident++;
+    }
+
+    blocks.back().nodes->push_back(value);
+    blocks.back().length++;
+    count++;
+    enforceBudget();
+}
+
+/**
+ * @brief Removes and returns the first value in the list. When the head
+ * block runs out, the next block (plus read-ahead) is loaded from disk.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param data Reference to store the retrieved data.
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T>
+bool SpillingDoublyLinked<T>::pop_front(T &data) {
+    if (count == 0)
+        return false;
+
+    blocks.front().nodes->pop_front(data);
+    blocks.front().length--;
+    count--;
+
+    if (blocks.front().length > 0)
+        return true;
+
+    blocks.pop_front();
+    headResident--;
+    if (blocks.empty()) {
+        headResident = 0;
+        tailResident = 0;
+        return true;
+    }
+
+    if (headResident == 0) {
+        if (tailResident == blocks.size()) {
+            headResident = 1;
+            tailResident--;
+        } else {
+            load(0);
+            headResident = 1;
+            size_t budget = static_cast<size_t>(config.residentBlocks);
+            for (int i = 0; i < config.readAheadBlocks; i++) {
+                if (headResident + tailResident >= blocks.size() || headResident + tailResident >= budget)
+                    break;
+                load(headResident);
+                headResident++;
+            }
+            enforceBudget();
+        }
+    }
+    return true;
+}
+
+template <typename T>
+size_t SpillingDoublyLinked<T>::size() const {
+    return count;
+}
+
+template <typename T>
+bool SpillingDoublyLinked<T>::isEmpty() const {
+    return count == 0;
+}
+
+/**
+ * @brief Counts the elements currently held in memory.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+size_t SpillingDoublyLinked<T>::residentElements() const {
+    size_t total = 0;
+    for (const Block &block : blocks) {
+        if (block.nodes)
+            total += block.length;
+    }
+    return total;
+}
+
+/**
+ * @brief Bytes of node storage the resident blocks may hold, excluding
+ * heap memory owned by the elements.
+ * 
+ * @tparam T The type of data stored in the list.
+ */
+template <typename T>
+size_t SpillingDoublyLinked<T>::budgetBytes() const {
+    return static_cast<size_t>(config.residentBlocks) * config.blockLength * sizeof(Node<T>);
+}
+
+/**
+ * @brief Visits every element in order. Spilled blocks are decoded by one
+ * SpillPrefetcher up to readAheadBlocks ahead of the visitor and are
+ * dropped once visited, so the scan does not grow the resident set.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param fn Called with each element.
+ * @param backward Visit from tail to head instead.
+ */
+template <typename T>
+template <typename F>
+void SpillingDoublyLinked<T>::scan(F fn, bool backward) {
+    file.flush();
+    size_t total = blocks.size();
+
+    vector<typename SpillPrefetcher<T>::Extent> extents;
+    for (size_t step = 0; step < total; step++) {
+        const Block &block = blocks[backward ? total - 1 - step : step];
+        if (!block.nodes)
+            extents.emplace_back(block.offset, block.length);
+    }
+    std::unique_ptr<SpillPrefetcher<T>> prefetcher;
+    if (!extents.empty() && config.readAheadBlocks > 0) {
+        prefetcher.reset(new SpillPrefetcher<T>(config.path, std::move(extents),
+                                                static_cast<size_t>(config.readAheadBlocks)));
+    }
+
+    for (size_t step = 0; step < total; step++) {
+        const Block &block = blocks[backward ? total - 1 - step : step];
+        if (block.nodes) {
+            if (backward) {
+                for (const T &value : block.nodes->reversed())
+                    fn(value);
+            } else {
+                for (const T &value : block.nodes->view())
+                    fn(value);
+            }
+            continue;
+        }
+
+        vector<T> values = prefetcher ? prefetcher->next()
+                                      : readSpilledBlock<T>(file, block.offset, block.length);
+        if (backward) {
+            for (auto it = values.rbegin(); it != values.rend(); ++it)
+                fn(*it);
+        } else {
+            for (const T &value : values)
+                fn(value);
+        }
+    }
+}
+
+/**
+ * @brief Visits every element from head to tail.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param fn Called with each element.
+ */
+template <typename T>
+template <typename F>
+void SpillingDoublyLinked<T>::forEachForward(F fn) {
+    scan(fn, false);
+}
+
+/**
+ * @brief Visits every element from tail to head.
+ * 
+ * @tparam T The type of data stored in the list.
+ * @param fn Called with each element.
+ */
+template <typename T>
+template <typename F>
+void SpillingDoublyLinked<T>::forEachBackward(F fn) {
+    scan(fn, true);
+}
+
+/**
+ * @brief Fixed-capacity doubly linked list usable in constant expressions.
+ * 
+ * Nodes are array slots linked by index, so a list built in a constexpr
+ * context needs no heap and a constexpr instance is placed in read-only
+ * data. Removed slots are reused through a free list.
+ * 
+ * @tparam T The type of data stored in the list; a literal type.
+ * @tparam N The maximum number of elements.
+ */
+template <typename T, size_t N>
+class StaticDoublyLinked {
+private:
+    T values[N] = {};
+    int prevs[N] = {};
+    int nexts[N] = {};
+    int head = -1;
+    int tail = -1;
+    int count = 0;
+    int used = 0;
+    int freeHead = -1;
+
+    constexpr int createNewNode(T value);
+    constexpr void releaseNode(int node);
+    constexpr void unlinkNode(int node);
+    constexpr int nodeAt(int index) const;
+
+public:
+    class iterator {
+    private:
+        const StaticDoublyLinked *list;
+        int node;
+        bool backward;
+
+    public:
+        constexpr iterator(const StaticDoublyLinked *list, int node, bool backward)
+            : list(list), node(node), backward(backward) {}
+        constexpr const T &operator*() const { return list->values[node]; }
+        constexpr iterator &operator++() {
+            node = backward ? list->prevs[node] : list->nexts[node];
+            return *this;
+        }
+        constexpr bool operator==(const iterator &other) const { return node == other.node; }
+        constexpr bool operator!=(const iterator &other) const { return node != other.node; }
+    };
+
+    constexpr StaticDoublyLinked() {}
+
+    //List manipulation functions, all usable at compile time
+    constexpr void push_front(T value);
+    constexpr bool insert(int index, T value);
+    constexpr void push_back(T value);
+    constexpr bool pop_front(T &data);
+    constexpr bool pop_back(T &data);
+    constexpr bool deleteNode(int index);
+    constexpr void deleteItem(T value);
+    constexpr bool reverseList();
+    constexpr bool elementAt(int index, T &value) const;
+    constexpr int indexOf(const T &value) const;
+    constexpr int size() const { return count; }
+    constexpr bool isEmpty() const { return count == 0; }
+    void displayList() const;
+
+    constexpr iterator begin() const { return iterator(this, head, false); }
+    constexpr iterator end() const { return iterator(this, -1, false); }
+    constexpr iterator rbegin() const { return iterator(this, tail, true); }
+    constexpr iterator rend() const { return iterator(this, -1, true); }
+};
+
+/**
+ * @brief Takes a slot from the free list or the unused tail of the array.
+ * 
+ * @return int The index of the new, unlinked node.
+ */
+template <typename T, size_t N>
+constexpr int StaticDoublyLinked<T, N>::createNewNode(T value) {
+    int node = -1;
+    if (freeHead != -1) {
+        node = freeHead;
+        freeHead = nexts[node];
+    } else {
+        if (used == static_cast<int>(N)) {
+            throw std::length_error("StaticDoublyLinked is full");
+        }
+        node = used++;
+    }
+    values[node] = value;
+    prevs[node] = -1;
+    nexts[node] = -1;
+    return node;
+}
+
+/**
+ * @brief Returns a slot to the free list.
+ */
+template <typename T, size_t N>
+constexpr void StaticDoublyLinked<T, N>::releaseNode(int node) {
+    nexts[node] = freeHead;
+    freeHead = node;
+}
+
+/**
+ * @brief Unlinks a node from the chain and returns its slot to the free list.
+ */
+template <typename T, size_t N>
+constexpr void StaticDoublyLinked<T, N>::unlinkNode(int node) {
+    if (prevs[node] != -1)
+        nexts[prevs[node]] = nexts[node];
+    else
+        head = nexts[node];
+
+    if (nexts[node] != -1)
+        prevs[nexts[node]] = prevs[node];
+    else
+        tail = prevs[node];
+
+    releaseNode(node);
+    count--;
+}
+
+/**
+ * @brief Finds the slot holding an index, walking from the nearer end.
+ */
+template <typename T, size_t N>
+constexpr int StaticDoublyLinked<T, N>::nodeAt(int index) const {
+    int node = -1;
+    if (index < count / 2) {
+        node = head;
+        for (int i = 0; i < index; i++)
+            node = nexts[node];
+    } else {
+        node = tail;
+        for (int i = count - 1; i > index; i--)
+            node = prevs[node];
+    }
+    return node;
+}
+
+/**
+ * @brief Adds a new node with the provided value to the front of the list.
+ * 
+ * @param value The value to be added.
+ */
+template <typename T, size_t N>
+constexpr void StaticDoublyLinked<T, N>::push_front(T value) {
+    int node = createNewNode(value);
+    if (head != -1) {
+        nexts[node] = head;
+        prevs[head] = node;
+    } else {
+        tail = node;
+    }
+    head = node;
+    count++;
+}
+
+/**
+ * @brief Inserts a new node with the provided value at the specified index.
+ * 
+ * @param index The index at which the value should be inserted.
+ * @param value The value to be inserted.
+ * @return bool True if insertion is successful, false otherwise.
+ */
+template <typename T, size_t N>
+constexpr bool StaticDoublyLinked<T, N>::insert(int index, T value) {
+    if (index < 0 || index > count)
+        return false;
+
+    if (index == 0) {
+        push_front(value);
+    } else if (index == count) {
+        push_back(value);
+    } else {
+        int nextNode = nodeAt(index);
+        int prevNode = prevs[nextNode];
+        int node = createNewNode(value);
+        prevs[node] = prevNode;
+        nexts[node] = nextNode;
+        nexts[prevNode] = node;
+        prevs[nextNode] = node;
+        count++;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds a new node with the provided value to the end of the list.
+ * 
+ * @param value The value to be added.
+ */
+template <typename T, size_t N>
+constexpr void StaticDoublyLinked<T, N>::push_back(T value) {
+    int node = createNewNode(value);
+    if (tail != -1) {
+        prevs[node] = tail;
+        nexts[tail] = node;
+    } else {
+        head = node;
+    }
+    tail = node;
+    count++;
+}
+
+/**
+ * @brief Removes and returns the value of the first node in the list.
+ * 
+ * @param data Reference to store the retrieved data.
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T, size_t N>
+constexpr bool StaticDoublyLinked<T, N>::pop_front(T &data) {
+    if (count == 0)
+        return false;
+
+    int node = head;
+    data = values[node];
+    head = nexts[node];
+    if (head != -1)
+        prevs[head] = -1;
+    else
+        tail = -1;
+    releaseNode(node);
+    count--;
+    return true;
+}
+
+/**
+ * @brief Removes and returns the value of the last node in the list.
+ * 
+ * @param data Reference to store the retrieved data.
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T, size_t N>
+constexpr bool StaticDoublyLinked<T, N>::pop_back(T &data) {
+    if (count == 0)
+        return false;
+
+    int node = tail;
+    data = values[node];
+    tail = prevs[node];
+    if (tail != -1)
+        nexts[tail] = -1;
+    else
+        head = -1;
+    releaseNode(node);
+    count--;
+    return true;
+}
+
+/**
+ * @brief Deletes the node at the specified index.
+ * 
+ * @param index The index of the node to be deleted.
+ * @return bool True if deletion is successful, false otherwise.
+ */
+template <typename T, size_t N>
+constexpr bool StaticDoublyLinked<T, N>::deleteNode(int index) {
+    if (index < 0 || index >= count)
+        return false;
+
+    unlinkNode(nodeAt(index));
+    return true;
+}
+
+/**
+ * @brief Deletes all nodes with the specified value.
+ * 
+ * @param value The value to be deleted.
+ */
+template <typename T, size_t N>
+constexpr void StaticDoublyLinked<T, N>::deleteItem(T value) {
+    int node = head;
+    while (node != -1) {
+        int nextNode = nexts[node];
+        if (values[node] == value)
+            unlinkNode(node);
+        node = nextNode;
+    }
+}
+
+/**
+ * @brief Reverses the order of elements by swapping the links of every node.
+ * 
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T, size_t N>
+constexpr bool StaticDoublyLinked<T, N>::reverseList() {
+    if (count == 0)
+        return false;
+
+    for (int node = head; node != -1; node = prevs[node]) {
+        int nextNode = nexts[node];
+        nexts[node] = prevs[node];
+        prevs[node] = nextNode;
+    }
+
+    int oldHead = head;
+    head = tail;
+    tail = oldHead;
+    return true;
+}
+
+/**
+ * @brief Retrieves the value at the specified index.
+ * 
+ * @param index The index of the value to be retrieved.
+ * @param value Reference to store the retrieved value.
+ * @return bool True if successful, false otherwise.
+ */
+template <typename T, size_t N>
+constexpr bool StaticDoublyLinked<T, N>::elementAt(int index, T &value) const {
+    if (index < 0 || index >= count)
+        return false;
+
+    value = values[nodeAt(index)];
+    return true;
+}
+
+/**
+ * @brief Finds the first index holding the provided value.
+ * 
+ * @param value The value to be searched for.
+ * @return int The index, or -1 if the value is not in the list.
+ */
+template <typename T, size_t N>
+constexpr int StaticDoublyLinked<T, N>::indexOf(const T &value) const {
+    int index = 0;
+    for (int node = head; node != -1; node = nexts[node]) {
+        if (values[node] == value)
+            return index;
+        index++;
+    }
+    return -1;
+}
+
+/**
+ * @brief Displays the elements of the list.
+ */
+template <typename T, size_t N>
+void StaticDoublyLinked<T, N>::displayList() const {
+    for (const T &value : *this) {
+        cout << value << "<==>";
+    }
+    cout << "BEGIN";
+}
+
+#endif
+
+// Class representing a Student
+class Student {
+private:
+    std::string name;
+    float gpa;
+    std::string address;
+
+public:
+    Student();
+    Student(std::string n, float g, std::string a);
+    Student(const Student &copyy);
+    Student &operator=(const Student &) = default;
+    std::string to_string() const;
+    const std::string &getName() const;
+    float getGpa() const;
+    const std::string &getAddress() const;
+    bool operator==(const Student&) const;
+    friend std::ostream &operator<<(std::ostream &oo, const Student &student);
+};
+
+// Overloading the << operator for easy printing of Student objects
+std::ostream &operator<<(std::ostream &oo, const Student &student) {
+    oo << student.to_string();
+    return oo;
+}
+
+// Default constructor for Student
+Student::Student() : name(""), gpa(0.0), address("") {}
+
+// Parameterized constructor for Student
+Student::Student(std::string n, float g, std::string a) : name(n), gpa(g), address(a) {}
+
+// Copy constructor for Student
+Student::Student(const Student &copyy) : name(copyy.name), gpa(copyy.gpa), address(copyy.address) {}
+
+// Converts Student object to a string
+std::string Student::to_string() const {
+    return "\nname: " + name + ", gpa: (" + std::to_string(gpa) + "), address: " + address;
+}
+
+// Overloading the == operator for Student
+bool Student::operator==(const Student &copyy) const {
+    return (name == copyy.name && gpa == copyy.gpa && address == copyy.address);
+}
+
+// Spill file encoding for Student: length-prefixed strings and the GPA
+template <>
+struct SpillCodec<Student> {
+    static void writeString(std::ostream &out, const std::string &value) {
+        uint32_t length = static_cast<uint32_t>(value.size());
+        out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        out.write(value.data(), length);
+    }
+
+    static bool readString(std::istream &in, std::string &value) {
+        uint32_t length;
+        if (!in.read(reinterpret_cast<char *>(&length), sizeof(length)))
+            return false;
+        value.resize(length);
+        return static_cast<bool>(in.read(&value[0], length));
+    }
+
+    static void write(std::ostream &out, const Student &student) {
+        float gpa = student.getGpa();
+        writeString(out, student.getName());
+        out.write(reinterpret_cast<const char *>(&gpa), sizeof(gpa));
+        writeString(out, student.getAddress());
+    }
+
+    static bool read(std::istream &in, Student &student) {
+        std::string name;
+        std::string address;
+        float gpa;
+        if (!readString(in, name) || !in.read(reinterpret_cast<char *>(&gpa), sizeof(gpa)) ||
+            !readString(in, address))
+            return false;
+        student = Student(name, gpa, address);
+        return true;
+    }
+};
+
+// Accessors for Student fields
+const std::string &Student::getName() const {
+    return name;
+}
+
+float Student::getGpa() const {
+    return gpa;
+}
+
+const std::string &Student::getAddress() const {
+    return address;
+}
+
+// Interning string pool: every distinct string is stored once and gets a
+// dense 32-bit id. Strings live in a deque so they never move, which keeps
+// the string_view keys of the lookup map valid.
+class StringPool {
+private:
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, uint32_t> ids;
+
+public:
+    static const uint32_t npos = UINT32_MAX;
+
+    uint32_t intern(const std::string &value);
+    uint32_t find(const std::string &value) const;
+    const std::string &at(uint32_t id) const;
+};
+
+// Returns the id of value, adding it to the pool if needed
+uint32_t StringPool::intern(const std::string &value) {
+    auto found = ids.find(value);
+    if (found != ids.end())
+        return found->second;
+
+    uint32_t id = static_cast<uint32_t>(strings.size());
+    strings.push_back(value);
+    ids.emplace(std::string_view(strings.back()), id);
+    return id;
+}
+
+// Returns the id of value, or npos if it was never interned
+uint32_t StringPool::find(const std::string &value) const {
+    auto found = ids.find(value);
+    return found == ids.end() ? npos : found->second;
+}
+
+const std::string &StringPool::at(uint32_t id) const {
+    return strings[id];
+}
+
+// Column-oriented storage for Student records. GPAs sit in one contiguous
+// float array and names/addresses are interned ids, so scans touch 4 bytes
+// per row instead of a whole Node<Student>. Row ids are stable: removing a
+// row only tombstones it (NaN GPA, npos name), and scans skip it for free.
+class StudentTable {
+public:
+    typedef uint32_t RowId;
+
+private:
+    vector<float> gpas;
+    vector<uint32_t> nameIds;
+    vector<uint32_t> addressIds;
+    StringPool names;
+    StringPool addresses;
+    size_t liveRows = 0;
+
+public:
+    RowId add(const Student &student);
+    bool remove(RowId row);
+    bool get(RowId row, Student &student) const;
+    size_t size() const;
+    vector<RowId> gpaBetween(float low, float high) const;
+    vector<RowId> findByName(const std::string &name) const;
+
+    static StudentTable fromList(DoublyLinked<Student> &list);
+    void toList(DoublyLinked<Student> &list) const;
+};
+
+// Appends a student and returns its row id
+StudentTable::RowId StudentTable::add(const Student &student) {
+    if (gpas.size() >= StringPool::npos) {
+        throw std::length_error("StudentTable is limited to 2^32 - 1 rows");
+    }
+    gpas.push_back(student.getGpa());
+    nameIds.push_back(names.intern(student.getName()));
+    addressIds.push_back(addresses.intern(student.getAddress()));
+    liveRows++;
+    return static_cast<RowId>(gpas.size() - 1);
+}
+
+// Tombstones a row; its id is never reused
+bool StudentTable::remove(RowId row) {
+    if (row >= gpas.size() || nameIds[row] == StringPool::npos)
+        return false;
+
+    gpas[row] = std::numeric_limits<float>::quiet_NaN();
+    nameIds[row] = StringPool::npos;
+    liveRows--;
+    return true;
+}
+
+// Rebuilds the Student stored in a row
+bool StudentTable::get(RowId row, Student &student) const {
+    if (row >= gpas.size() || nameIds[row] == StringPool::npos)
+        return false;
+
+    student = Student(names.at(nameIds[row]), gpas[row], addresses.at(addressIds[row]));
+    return true;
+}
+
+size_t StudentTable::size() const {
+    return liveRows;
+}
+
+// Returns the rows with low <= gpa <= high, four GPAs per compare with SSE2
+vector<StudentTable::RowId> StudentTable::gpaBetween(float low, float high) const {
+    vector<RowId> rows;
+    const float *gpa = gpas.data();
+    size_t total = gpas.size();
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    __m128 lows = _mm_set1_ps(low);
+    __m128 highs = _mm_set1_ps(high);
+    for (; i + 4 <= total; i += 4) {
+        __m128 values = _mm_loadu_ps(gpa + i);
+        int mask = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(values, lows), _mm_cmple_ps(values, highs)));
+        while (mask != 0) {
+            int lane = __builtin_ctz(mask);
+            rows.push_back(static_cast<RowId>(i + lane));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i < total; i++) {
+        if (gpa[i] >= low && gpa[i] <= high)
+            rows.push_back(static_cast<RowId>(i));
+    }
+    return rows;
+}
+
+// Returns the rows whose name equals name, comparing four ids at a time
+vector<StudentTable::RowId> StudentTable::findByName(const std::string &name) const {
+    vector<RowId> rows;
+    uint32_t id = names.find(name);
+    if (id == StringPool::npos)
+        return rows;
+
+    const uint32_t *ids = nameIds.data();
+    size_t total = nameIds.size();
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    __m128i wanted = _mm_set1_epi32(static_cast<int>(id));
+    for (; i + 4 <= total; i += 4) {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ids + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(values, wanted)));
+        while (mask != 0) {
+            int lane = __builtin_ctz(mask);
+            rows.push_back(static_cast<RowId>(i + lane));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i < total; i++) {
+        if (ids[i] == id)
+            rows.push_back(static_cast<RowId>(i));
+    }
+    return rows;
+}
+
+// Builds a table from a list; row ids follow list order
+StudentTable StudentTable::fromList(DoublyLinked<Student> &list) {
+    StudentTable table;
+    for (const Student &student : list.view()) {
+        table.add(student);
+    }
+    return table;
+}
+
+// Appends every live row to a list in row id order
+void StudentTable::toList(DoublyLinked<Student> &list) const {
+    Student student;
+    for (RowId row = 0; row < gpas.size(); row++) {
+        if (get(row, student))
+            list.push_back(student);
+    }
+}
+
+// Naive LRU used as the benchmark baseline: a map plus a recency list that
+// is searched linearly on every hit
+class NaiveLru {
+private:
+    std::map<int, int> values;
+    std::list<int> recency;
+    size_t capacity;
+
+public:
+    explicit NaiveLru(size_t c) : capacity(c) {}
+
+    bool get(int key, int &value) {
+        auto found = values.find(key);
+        if (found == values.end())
+            return false;
+        recency.remove(key);
+        recency.push_front(key);
+        value = found->second;
+        return true;
+    }
+
+    void put(int key, int value) {
+        if (values.count(key) != 0)
+            recency.remove(key);
+        else if (values.size() == capacity) {
+            values.erase(recency.back());
+            recency.pop_back();
+        }
+        values[key] = value;
+        recency.push_front(key);
+    }
+};
+
+// Runs the same get-or-put workload through a cache and returns milliseconds;
+// concurrent callers pass different seeds so they do not touch keys in lockstep
+template <typename Cache>
+double timeLruWorkload(Cache &cache, int operations, int keySpace, unsigned int seed = 12345) {
+    auto start = std::chrono::steady_clock::now();
+    int value = 0;
+    for (int i = 0; i < operations; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int key = static_cast<int>((seed >> 8) % keySpace);
+        if (!cache.get(key, value))
+            cache.put(key, i);
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+// Main function
+int main() {
+    //Creating a doubly linked list of Students 
+    DoublyLinked<Student> studVector;
+    //Adding students to the list 
+    Student student1("student1", 4.0, "address1");
+    studVector.push_back(student1);
+    //Likewise for other students 
+    Student student2("student2", 4.0, "address2");
+    studVector.push_back(student2);
+    Student student3("student3", 4.0, "address3");
+    studVector.push_back(student3);
+    Student student4("student4", 4.0, "address4");
+    studVector.push_back(student4);
+    Student student5("student5", 4.0, "address5");
+    studVector.push_back(student5);
+    Student student6("student6", 4.0, "address6");
+    studVector.push_back(student6);
+    Student student7("student7", 4.0, "address7");
+    studVector.push_back(student7);
+    Student student8("student8", 4.0, "address8");
+    studVector.push_back(student8);
+    Student student9("student9", 4.0, "address9");
+    studVector.push_back(student9);
+    Student student10("student10", 4.0, "address10");
+    studVector.push_back(student10);
+    studVector.displayList();
+    cout << endl;
+
+    //Creating a copy of the list using the copy constructor 
+    DoublyLinked<Student> cpStudVector = studVector;
+    cpStudVector.displayList();
+    cout << endl << endl;
+
+    //Reversing the original list 
+    studVector.reverseList();
+    studVector.displayList();
+    cout << endl << endl;
+
+    //Searching for students with a specific value and printing them 
+    Student stObj("student5", 4.0, "address5");
+    vector<Node<Student>*> nodes = studVector.searchItems(stObj);
+
+    for (const auto& node : nodes) {
+        cout << node->data << " ";
+    }
+    cout << endl << endl;
+
+    //Deleting a note at a specific index and displaying the updated list
+    studVector.deleteNode(7);
+    studVector.displayList();
+    cout << endl << endl;
+
+    //LRU cache: put, hit, and eviction of the least recently used entry
+    LruCache<std::string, Student> studCache(2);
+    studCache.put("student1", student1);
+    studCache.put("student2", student2);
+    Student cached;
+    studCache.get("student1", cached);
+    studCache.put("student3", student3);
+    cout << "student2 cached: " << studCache.get("student2", cached) << endl;
+    cout << "hits: " << studCache.hits() << ", misses: " << studCache.misses()
+         << ", evictions: " << studCache.evictions() << endl;
+
+    //Benchmark against the naive map+list implementation
+    const int operations = 200000;
+    const int keySpace = 2048;
+    const size_t lruCapacity = 1024;
+    LruCache<int, int> fastLru(lruCapacity);
+    ShardedLruCache<int, int> shardedLru(lruCapacity, 8);
+    NaiveLru naiveLru(lruCapacity);
+    cout << "LruCache: " << timeLruWorkload(fastLru, operations, keySpace) << " ms" << endl;
+    cout << "ShardedLruCache: " << timeLruWorkload(shardedLru, operations, keySpace) << " ms" << endl;
+    cout << "Naive map+list: " << timeLruWorkload(naiveLru, operations, keySpace) << " ms" << endl;
+
+    //The same workload from several threads on one shared sharded cache
+    const int lruThreads = 4;
+    ShardedLruCache<int, int> sharedLru(lruCapacity, 8);
+    vector<std::thread> lruWorkers;
+    auto sharedStart = std::chrono::steady_clock::now();
+    for (int t = 0; t < lruThreads; t++) {
+        lruWorkers.emplace_back([&sharedLru, t]() {
+            timeLruWorkload(sharedLru, operations, keySpace, 12345u + t);
+        });
+    }
+    for (std::thread &worker : lruWorkers)
+        worker.join();
+    std::chrono::duration<double, std::milli> sharedElapsed = std::chrono::steady_clock::now() - sharedStart;
+    cout << "ShardedLruCache, " << lruThreads << " threads: " << sharedElapsed.count() << " ms for "
+         << lruThreads * operations << " operations" << endl;
+
+
+    //Views: the last four students in reverse order, skipping student2
+    for (const Student &student : studVector.reversed().slice(0, 4).filter(
+             [&](const Student &s) { return !(s == student2); })) {
+        cout << student << "<==>";
+    }
+    cout << "BEGIN" << endl;
+
+    //Compaction: scatter a list with random deletes and inserts, then
+    //relocate its nodes back into list order
+    DoublyLinked<int> churned;
+    churned.reserveNodes(10000);
+    for (int i = 0; i < 10000; i++)
+        churned.push_back(i);
+    unsigned int churnSeed = 7;
+    for (int i = 0; i < 5000; i++) {
+        churnSeed = churnSeed * 1103515245u + 12345u;
+        churned.deleteNode(static_cast<int>((churnSeed >> 8) % 10000));
+        churnSeed = churnSeed * 1103515245u + 12345u;
+        churned.insert(static_cast<int>((churnSeed >> 8) % 9999), i);
+    }
+    cout << "fragmentation before compact: " << churned.fragmentation() << endl;
+    churned.compact();
+    cout << "fragmentation after compact: " << churned.fragmentation() << endl;
+
+    //Columnar table: GPA range scan and name lookup
+    StudentTable studTable = StudentTable::fromList(studVector);
+    cout << "students with gpa >= 3.5: " << studTable.gpaBetween(3.5f, 4.0f).size() << endl;
+    vector<StudentTable::RowId> rows = studTable.findByName("student5");
+    Student found;
+    if (!rows.empty() && studTable.get(rows[0], found))
+        cout << "found by name:" << found << endl;
+
+    //Spilling list: only two blocks of two students stay in memory
+    SpillConfig spillConfig;
+    spillConfig.path = "students.spill";
+    spillConfig.blockLength = 2;
+    spillConfig.residentBlocks = 2;
+    spillConfig.readAheadBlocks = 1;
+    SpillingDoublyLinked<Student> spilled(spillConfig);
+    spilled.push_back(student1);
+    spilled.push_back(student2);
+    spilled.push_back(student3);
+    spilled.push_back(student4);
+    spilled.push_back(student5);
+    spilled.push_back(student6);
+    spilled.push_back(student7);
+    cout << "resident " << spilled.residentElements() << " of " << spilled.size()
+         << " (budget " << spilled.budgetBytes() << " bytes):";
+    spilled.forEachForward([](const Student &s) { cout << " " << s.getName(); });
+    cout << endl;
+    Student popped;
+    spilled.pop_front(popped);
+    spilled.pop_front(popped);
+    spilled.pop_front(popped);
+    cout << "backward after 3 pops:";
+    spilled.forEachBackward([](const Student &s) { cout << " " << s.getName(); });
+    cout << endl;
+
+    //Static list: built by the compiler through push_back, no heap at runtime
+    static constexpr StaticDoublyLinked<int, 8> staticIds = [] {
+        StaticDoublyLinked<int, 8> ids;
+        ids.push_back(101);
+        ids.push_back(102);
+        ids.push_back(104);
+        ids.insert(2, 103);
+        ids.push_front(100);
+        return ids;
+    }();
+    static_assert(staticIds.size() == 5 && staticIds.indexOf(103) == 3, "static list is built at compile time");
+    staticIds.displayList();
+    cout << endl;
+
+    //Copy-on-write list: the backup shares storage until one side changes
+    CowDoublyLinked<Student> cowStudents(4);
+    cowStudents.push_back(student1);
+    cowStudents.push_back(student2);
+    cowStudents.push_back(student3);
+    cowStudents.push_back(student4);
+    cowStudents.push_back(student5);
+    cowStudents.push_back(student6);
+    CowDoublyLinked<Student> cowBackup = cowStudents;
+    cout << endl << "backup shares storage: " << cowBackup.sharesStorageWith(cowStudents) << endl;
+    cowStudents.deleteNode(5);
+    cowStudents.displayList();
+    cout << endl;
+    cowBackup.displayList();
+    cout << endl << "backup still shares untouched segments: "
+         << cowBackup.sharesStorageWith(cowStudents) << endl;
 
     return 0;
 }
@@ -1,4 +1,17 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 using namespace std;
 
@@ -107,6 +120,451 @@ public:
     }
 };
 
+// Node of the compact list: one link holding prev ^ next as arena offsets,
+// 8 bytes per element instead of the 24 bytes of Node
+struct XorNode {
+    int data;
+    uint32_t link;
+};
+
+// Memory-compact doubly linked list of ints. Nodes live in one pooled
+// arena and are addressed by 32-bit offsets; offset 0 is reserved as the
+// null link. Removed slots are kept on a free list and reused.
+class XorLinkedList {
+private:
+    vector<XorNode> arena;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t freeHead;
+    size_t count;
+
+    // Take a slot from the free list, or grow the arena
+    uint32_t allocate(int value) {
+        uint32_t slot;
+        if (freeHead != 0) {
+            slot = freeHead;
+            freeHead = arena[slot].link;
+        } else {
+            if (arena.size() > UINT32_MAX) {
+                throw length_error("XorLinkedList arena is limited to 2^32 - 1 nodes");
+            }
+            slot = static_cast<uint32_t>(arena.size());
+            arena.push_back(XorNode());
+        }
+        arena[slot].data = value;
+        arena[slot].link = 0;
+        return slot;
+    }
+
+    // Give a slot back to the free list
+    void release(uint32_t slot) {
+        arena[slot].link = freeHead;
+        freeHead = slot;
+    }
+
+public:
+    XorLinkedList() {
+        arena.push_back(XorNode());  // slot 0 is the null link
+        head = 0;
+        tail = 0;
+        freeHead = 0;
+        count = 0;
+    }
+
+    // Pre-size the arena so bulk loads do not reallocate
+    void reserve(size_t nodes) {
+        arena.reserve(nodes + 1);
+    }
+
+    // Insertion at the beginning of the list
+    void insert(int value) {
+        uint32_t newNode = allocate(value);
+        if (head == 0) {
+            tail = newNode;
+        } else {
+            arena[newNode].link = head;
+            arena[head].link ^= newNode;
+        }
+        head = newNode;
+        count++;
+    }
+
+    // Insertion at the end of the list
+    void append(int value) {
+        uint32_t newNode = allocate(value);
+        if (tail == 0) {
+            head = newNode;
+        } else {
+            arena[newNode].link = tail;
+            arena[tail].link ^= newNode;
+        }
+        tail = newNode;
+        count++;
+    }
+
+    // Deletion of the first node holding value; false if it is not present
+    bool remove(int value) {
+        uint32_t prev = 0;
+        uint32_t current = head;
+
+        while (current != 0 && arena[current].data != value) {
+            uint32_t next = arena[current].link ^ prev;
+            prev = current;
+            current = next;
+        }
+
+        if (current == 0) {
+            return false;
+        }
+
+        uint32_t next = arena[current].link ^ prev;
+        if (prev != 0) {
+            arena[prev].link ^= current ^ next;
+        } else {
+            head = next;
+        }
+        if (next != 0) {
+            arena[next].link ^= current ^ prev;
+        } else {
+            tail = prev;
+        }
+
+        release(current);
+        count--;
+        return true;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    // Display the list in forward direction
+    void displayForward() const {
+        uint32_t prev = 0;
+        uint32_t current = head;
+        cout << "XOR Linked List (Forward): ";
+        while (current != 0) {
+            cout << arena[current].data << " <-> ";
+            uint32_t next = arena[current].link ^ prev;
+            prev = current;
+            current = next;
+        }
+        cout << "nullptr" << endl;
+    }
+
+    // Display the list in reverse direction
+    void displayReverse() const {
+        uint32_t next = 0;
+        uint32_t current = tail;
+        cout << "XOR Linked List (Reverse): ";
+        while (current != 0) {
+            cout << arena[current].data << " <-> ";
+            uint32_t prev = arena[current].link ^ next;
+            next = current;
+            current = prev;
+        }
+        cout << "nullptr" << endl;
+    }
+};
+
+// Size of a cache line; hot indices are padded to it to avoid false sharing
+static const size_t CacheLine = 64;
+
+// Producer side of RingBufferQueue: one thread, or any number of threads
+enum class QueueMode { SingleProducer, MultiProducer };
+
+// Bounded lock-free FIFO of ints for passing values between pipeline
+// stages without allocating. Capacity is rounded up to a power of two.
+// SingleProducer is a classic SPSC ring: each side owns one index and
+// keeps a cached copy of the other's. MultiProducer lets producers claim
+// slots with a CAS and publish them through per-slot sequence numbers;
+// there is always exactly one consumer.
+template <QueueMode Mode>
+class RingBufferQueue {
+private:
+    alignas(CacheLine) atomic<size_t> tail;     // next index to write
+    alignas(CacheLine) size_t cachedHead;       // producer's view of head (SPSC)
+    alignas(CacheLine) atomic<size_t> head;     // next index to read
+    alignas(CacheLine) size_t cachedTail;       // consumer's view of tail (SPSC)
+    alignas(CacheLine) size_t mask;
+    vector<int> values;
+    unique_ptr<atomic<size_t>[]> sequences;     // MPSC only
+
+    // Spin briefly, then give the core away so a blocked side lets the
+    // other one make progress (backpressure)
+    static void backoff(int& spins) {
+        if (++spins < 64) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        } else {
+            this_thread::yield();
+        }
+    }
+
+public:
+    explicit RingBufferQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        mask = size - 1;
+        values.resize(size);
+        tail.store(0, memory_order_relaxed);
+        head.store(0, memory_order_relaxed);
+        cachedHead = 0;
+        cachedTail = 0;
+        if (Mode == QueueMode::MultiProducer) {
+            sequences.reset(new atomic<size_t>[size]);
+            for (size_t i = 0; i < size; i++) {
+                sequences[i].store(i, memory_order_relaxed);
+            }
+        }
+    }
+
+    RingBufferQueue(const RingBufferQueue&) = delete;
+    RingBufferQueue& operator=(const RingBufferQueue&) = delete;
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    // Enqueue one value; false if the queue is full
+    bool tryEnqueue(int value) {
+        return tryEnqueueBatch(&value, 1) == 1;
+    }
+
+    // Enqueue up to count values in order; returns how many fit
+    size_t tryEnqueueBatch(const int* batch, size_t count) {
+        size_t pos = tail.load(memory_order_relaxed);
+        size_t room;
+
+        if (Mode == QueueMode::SingleProducer) {
+            room = capacity() - (pos - cachedHead);
+            if (room < count) {
+                cachedHead = head.load(memory_order_acquire);
+                room = capacity() - (pos - cachedHead);
+            }
+            size_t taken = room < count ? room : count;
+            for (size_t i = 0; i < taken; i++) {
+                values[(pos + i) & mask] = batch[i];
+            }
+            tail.store(pos + taken, memory_order_release);
+            return taken;
+        }
+
+        // Claim a run of slots the consumer has already released
+        size_t taken;
+        do {
+            room = capacity() - (pos - head.load(memory_order_acquire));
+            taken = room < count ? room : count;
+            if (taken == 0) {
+                return 0;
+            }
+        } while (!tail.compare_exchange_weak(pos, pos + taken, memory_order_relaxed));
+
+        for (size_t i = 0; i < taken; i++) {
+            size_t slot = (pos + i) & mask;
+            values[slot] = batch[i];
+            sequences[slot].store(pos + i + 1, memory_order_release);
+        }
+        return taken;
+    }
+
+    // Dequeue one value; false if the queue is empty
+    bool tryDequeue(int& value) {
+        return tryDequeueBatch(&value, 1) == 1;
+    }
+
+    // Dequeue up to count values in order; returns how many were read
+    size_t tryDequeueBatch(int* batch, size_t count) {
+        size_t pos = head.load(memory_order_relaxed);
+        size_t taken = 0;
+
+        if (Mode == QueueMode::SingleProducer) {
+            size_t ready = cachedTail - pos;
+            if (ready < count) {
+                cachedTail = tail.load(memory_order_acquire);
+                ready = cachedTail - pos;
+            }
+            taken = ready < count ? ready : count;
+            for (size_t i = 0; i < taken; i++) {
+                batch[i] = values[(pos + i) & mask];
+            }
+        } else {
+            // Producers may publish out of order; stop at the first slot
+            // that is claimed but not yet written
+            while (taken < count) {
+                size_t slot = (pos + taken) & mask;
+                if (sequences[slot].load(memory_order_acquire) != pos + taken + 1) {
+                    break;
+                }
+                batch[taken] = values[slot];
+                sequences[slot].store(pos + taken + capacity(), memory_order_relaxed);
+                taken++;
+            }
+        }
+
+        if (taken > 0) {
+            head.store(pos + taken, memory_order_release);
+        }
+        return taken;
+    }
+
+    // Enqueue one value, waiting while the queue is full
+    void enqueue(int value) {
+        int spins = 0;
+        while (!tryEnqueue(value)) {
+            backoff(spins);
+        }
+    }
+
+    // Enqueue all values in order, waiting for room as needed
+    void enqueueBatch(const int* batch, size_t count) {
+        int spins = 0;
+        while (count > 0) {
+            size_t sent = tryEnqueueBatch(batch, count);
+            if (sent == 0) {
+                backoff(spins);
+                continue;
+            }
+            spins = 0;
+            batch += sent;
+            count -= sent;
+        }
+    }
+
+    // Dequeue one value, waiting while the queue is empty
+    int dequeue() {
+        int value;
+        int spins = 0;
+        while (!tryDequeue(value)) {
+            backoff(spins);
+        }
+        return value;
+    }
+
+    // Dequeue between 1 and count values, waiting while the queue is empty
+    size_t dequeueBatch(int* batch, size_t count) {
+        int spins = 0;
+        size_t received;
+        while ((received = tryDequeueBatch(batch, count)) == 0) {
+            backoff(spins);
+        }
+        return received;
+    }
+};
+
+// Pin the calling thread to one CPU (Linux only; elsewhere a no-op)
+void pinToCpu(unsigned cpu) {
+#if defined(__linux__)
+    unsigned cpus = thread::hardware_concurrency();
+    if (cpus == 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+// Streams items from producer threads to one consumer through a queue that
+// is kept saturated and returns the throughput in millions of items/s
+template <QueueMode Mode>
+double ringBufferThroughput(int producers, int itemsPerProducer, size_t batchSize) {
+    RingBufferQueue<Mode> queue(4096);
+    int total = producers * itemsPerProducer;
+
+    auto start = chrono::steady_clock::now();
+    thread consumer([&] {
+        pinToCpu(0);
+        vector<int> batch(batchSize);
+        int received = 0;
+        while (received < total) {
+            received += static_cast<int>(queue.dequeueBatch(batch.data(), batch.size()));
+        }
+    });
+
+    vector<thread> senders;
+    for (int p = 0; p < producers; p++) {
+        senders.emplace_back([&, p] {
+            pinToCpu(p + 1);
+            vector<int> batch;
+            int first = p * itemsPerProducer;
+            for (int item = first; item < first + itemsPerProducer; item++) {
+                batch.push_back(item);
+                if (batch.size() == batchSize || item + 1 == first + itemsPerProducer) {
+                    queue.enqueueBatch(batch.data(), batch.size());
+                    batch.clear();
+                }
+            }
+        });
+    }
+
+    for (thread& sender : senders) {
+        sender.join();
+    }
+    consumer.join();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return total / elapsed.count() / 1e6;
+}
+
+// Measures handoff latency with a ping-pong between two otherwise empty
+// queues: one thread sends a batch and waits for it to come back, so each
+// sample is a round trip with no queueing in front of it. Fills in the
+// p50 and p99 one-way latency in nanoseconds.
+template <QueueMode Mode>
+void ringBufferLatency(size_t batchSize, int roundTrips, double& p50, double& p99) {
+    RingBufferQueue<Mode> ping(4096);
+    RingBufferQueue<Mode> pong(4096);
+
+    thread echo([&] {
+        pinToCpu(1);
+        vector<int> batch(batchSize);
+        for (int trip = 0; trip < roundTrips; trip++) {
+            size_t received = 0;
+            while (received < batchSize) {
+                received += ping.dequeueBatch(batch.data() + received, batchSize - received);
+            }
+            pong.enqueueBatch(batch.data(), batchSize);
+        }
+    });
+
+    pinToCpu(0);
+    vector<int> batch(batchSize);
+    vector<double> oneWay;
+    oneWay.reserve(roundTrips);
+    for (int trip = 0; trip < roundTrips; trip++) {
+        for (size_t i = 0; i < batchSize; i++) {
+            batch[i] = trip;
+        }
+        auto sent = chrono::steady_clock::now();
+        ping.enqueueBatch(batch.data(), batchSize);
+        size_t received = 0;
+        while (received < batchSize) {
+            received += pong.dequeueBatch(batch.data() + received, batchSize - received);
+        }
+        oneWay.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - sent).count() / 2);
+    }
+    echo.join();
+
+    sort(oneWay.begin(), oneWay.end());
+    p50 = oneWay[oneWay.size() / 2];
+    p99 = oneWay[oneWay.size() * 99 / 100];
+}
+
+// Reports saturated throughput and ping-pong handoff latency for one
+// queue configuration
+template <QueueMode Mode>
+void benchmarkRingBuffer(const char* name, int producers, int itemsPerProducer, size_t batchSize) {
+    double mops = ringBufferThroughput<Mode>(producers, itemsPerProducer, batchSize);
+    double p50 = 0;
+    double p99 = 0;
+    ringBufferLatency<Mode>(batchSize, 20000, p50, p99);
+    cout << name << ": " << mops << " Mops/s, handoff p50 " << p50 << " ns, p99 " << p99 << " ns" << endl;
+}
+
 int main() {
     DoublyLinkedList list;
 
@@ -119,5 +577,33 @@ int main() {
     list.remove(10);
     list.displayForward();
 
+    XorLinkedList compact;
+
+    compact.insert(5);
+    compact.insert(10);
+    compact.insert(15);
+    compact.append(20);
+    compact.displayForward();
+    compact.displayReverse();
+
+    compact.remove(10);
+    compact.displayForward();
+    compact.displayReverse();
+
+    RingBufferQueue<QueueMode::SingleProducer> fifo(4);
+    int staged[] = {1, 2, 3, 4, 5};
+    cout << "Ring buffer accepted " << fifo.tryEnqueueBatch(staged, 5) << " of 5" << endl;
+    cout << "Ring buffer (FIFO): ";
+    int value;
+    while (fifo.tryDequeue(value)) {
+        cout << value << " ";
+    }
+    cout << endl;
+
+    benchmarkRingBuffer<QueueMode::SingleProducer>("SPSC", 1, 10000000, 1);
+    benchmarkRingBuffer<QueueMode::SingleProducer>("SPSC batch 32", 1, 10000000, 32);
+    benchmarkRingBuffer<QueueMode::MultiProducer>("MPSC 2 producers", 2, 5000000, 1);
+    benchmarkRingBuffer<QueueMode::MultiProducer>("MPSC 2 producers batch 32", 2, 5000000, 32);
+
     return 0;
 }
@@ -1,4 +1,8 @@
+#include <cstddef>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 using namespace std;
 
 // Definition of a tree node
@@ -131,6 +135,336 @@ public:
     }
 };
 
+// Definition of an immutable tree node shared between tree versions
+struct PersistentNode {
+    const int val;
+    const shared_ptr<const PersistentNode> left;
+    const shared_ptr<const PersistentNode> right;
+
+    PersistentNode(int x, shared_ptr<const PersistentNode> l, shared_ptr<const PersistentNode> r)
+        : val(x), left(move(l)), right(move(r)) {}
+};
+
+using PersistentNodePtr = shared_ptr<const PersistentNode>;
+
+// Read-only version of a PersistentBST. Holding it keeps its nodes alive,
+// and later inserts/deletes on the tree never change what it sees.
+class BSTSnapshot {
+private:
+    PersistentNodePtr root;
+
+    // Helper function for inorder traversal
+    void inorderHelper(const PersistentNode* node) const {
+        if (node == nullptr) return;
+
+        inorderHelper(node->left.get());
+        cout << node->val << " ";
+        inorderHelper(node->right.get());
+    }
+
+    // Helper function for preorder traversal
+    void preorderHelper(const PersistentNode* node) const {
+        if (node == nullptr) return;
+
+        cout << node->val << " ";
+        preorderHelper(node->left.get());
+        preorderHelper(node->right.get());
+    }
+
+    // Helper function for postorder traversal
+    void postorderHelper(const PersistentNode* node) const {
+        if (node == nullptr) return;
+
+        postorderHelper(node->left.get());
+        postorderHelper(node->right.get());
+        cout << node->val << " ";
+    }
+
+public:
+    // Constructor
+    explicit BSTSnapshot(PersistentNodePtr r) : root(move(r)) {}
+
+    // Search operation
+    bool contains(int val) const {
+        const PersistentNode* node = root.get();
+        while (node != nullptr) {
+            if (val < node->val) {
+                node = node->left.get();
+            } else if (val > node->val) {
+                node = node->right.get();
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Inorder traversal
+    void inorderTraversal() const {
+        inorderHelper(root.get());
+        cout << endl;
+    }
+
+    // Preorder traversal
+    void preorderTraversal() const {
+        preorderHelper(root.get());
+        cout << endl;
+    }
+
+    // Postorder traversal
+    void postorderTraversal() const {
+        postorderHelper(root.get());
+        cout << endl;
+    }
+};
+
+// Binary Search Tree with path copying. Insert and delete copy only the
+// nodes on the path from the root to the change and share every other
+// subtree, so snapshot() is O(1) and old versions are freed by reference
+// counting once the last snapshot holding them goes away.
+class PersistentBST {
+private:
+    // Always read and written with atomic_load/atomic_store. Readers never
+    // take writeMutex, but libstdc++ implements these with a small internal
+    // lock pool, so snapshot() can wait briefly while a writer swaps the
+    // root. The free functions are deprecated in C++20 in favour of
+    // std::atomic<std::shared_ptr<...>>.
+    PersistentNodePtr root;
+
+    // Serializes writers against each other only
+    mutex writeMutex;
+
+    // Helper function for inserting a value; returns the new subtree root
+    PersistentNodePtr insertHelper(const PersistentNodePtr& node, int val) {
+        if (node == nullptr) {
+            return make_shared<const PersistentNode>(val, nullptr, nullptr);
+        }
+
+        if (val < node->val) {
+            PersistentNodePtr left = insertHelper(node->left, val);
+            if (left == node->left) return node;
+            return make_shared<const PersistentNode>(node->val, left, node->right);
+        } else if (val > node->val) {
+            PersistentNodePtr right = insertHelper(node->right, val);
+            if (right == node->right) return node;
+            return make_shared<const PersistentNode>(node->val, node->left, right);
+        }
+
+        // Duplicate value: nothing changes, keep sharing this subtree
+        return node;
+    }
+
+    // Helper function to find the minimum value node in a subtree
+    const PersistentNode* findMin(const PersistentNode* node) const {
+        while (node->left != nullptr) {
+            node = node->left.get();
+        }
+        return node;
+    }
+
+    // Helper function to delete a value; returns the new subtree root
+    PersistentNodePtr deleteNodeHelper(const PersistentNodePtr& node, int val) {
+        if (node == nullptr) return node;
+
+        if (val < node->val) {
+            PersistentNodePtr left = deleteNodeHelper(node->left, val);
+            if (left == node->left) return node;
+            return make_shared<const PersistentNode>(node->val, left, node->right);
+        } else if (val > node->val) {
+            PersistentNodePtr right = deleteNodeHelper(node->right, val);
+            if (right == node->right) return node;
+            return make_shared<const PersistentNode>(node->val, node->left, right);
+        }
+
+        // Node to be deleted found
+        if (node->left == nullptr) return node->right;
+        if (node->right == nullptr) return node->left;
+
+        // Node with two children: replace it by a copy carrying the inorder
+        // successor's value and drop the successor from the right subtree
+        int successor = findMin(node->right.get())->val;
+        return make_shared<const PersistentNode>(
+            successor, node->left, deleteNodeHelper(node->right, successor));
+    }
+
+public:
+    // Constructor
+    PersistentBST() : root(nullptr) {}
+
+    // Insertion operation
+    void insert(int val) {
+        lock_guard<mutex> lock(writeMutex);
+        atomic_store(&root, insertHelper(atomic_load(&root), val));
+    }
+
+    // Deletion operation
+    void deleteNode(int val) {
+        lock_guard<mutex> lock(writeMutex);
+        atomic_store(&root, deleteNodeHelper(atomic_load(&root), val));
+    }
+
+    // Returns an immutable view of the current version in O(1)
+    BSTSnapshot snapshot() const {
+        return BSTSnapshot(atomic_load(&root));
+    }
+
+    // Inorder traversal of the current version
+    void inorderTraversal() const {
+        snapshot().inorderTraversal();
+    }
+};
+
+// Fixed-capacity Binary Search Tree that can be built and balanced at
+// compile time. Nodes live in arrays linked by index, so a constexpr
+// instance needs no heap and is placed in read-only data.
+template <size_t N>
+class StaticBST {
+private:
+    int vals[N] = {};
+    int lefts[N] = {};
+    int rights[N] = {};
+    int root = -1;
+    int count = 0;
+
+    // Helper function for building a balanced subtree from sorted values
+    constexpr int buildHelper(const int* sorted, int low, int high) {
+        if (low > high) return -1;
+
+        int mid = low + (high - low) / 2;
+        int node = count++;
+        vals[node] = sorted[mid];
+        lefts[node] = buildHelper(sorted, low, mid - 1);
+        rights[node] = buildHelper(sorted, mid + 1, high);
+        return node;
+    }
+
+    // Helper function for inorder traversal
+    void inorderHelper(int node) const {
+        if (node == -1) return;
+
+        inorderHelper(lefts[node]);
+        cout << vals[node] << " ";
+        inorderHelper(rights[node]);
+    }
+
+    // Helper function for preorder traversal
+    void preorderHelper(int node) const {
+        if (node == -1) return;
+
+        cout << vals[node] << " ";
+        preorderHelper(lefts[node]);
+        preorderHelper(rights[node]);
+    }
+
+    // Helper function for postorder traversal
+    void postorderHelper(int node) const {
+        if (node == -1) return;
+
+        postorderHelper(lefts[node]);
+        postorderHelper(rights[node]);
+        cout << vals[node] << " ";
+    }
+
+public:
+    // Constructor for an empty tree
+    constexpr StaticBST() {}
+
+    // Constructor building a balanced tree from a list of keys
+    constexpr StaticBST(const int (&keys)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            insert(keys[i]);
+        }
+        balance();
+    }
+
+    // Insertion operation; duplicates are ignored like in BST
+    constexpr void insert(int val) {
+        int* link = &root;
+        while (*link != -1) {
+            if (val < vals[*link]) {
+                link = &lefts[*link];
+            } else if (val > vals[*link]) {
+                link = &rights[*link];
+            } else {
+                return;
+            }
+        }
+
+        if (count == static_cast<int>(N)) {
+            throw length_error("StaticBST is full");
+        }
+        vals[count] = val;
+        lefts[count] = -1;
+        rights[count] = -1;
+        *link = count++;
+    }
+
+    // Rebuilds the tree with minimal height. The inorder walk uses an
+    // explicit stack so degenerate trees stay within constexpr limits.
+    constexpr void balance() {
+        int sorted[N] = {};
+        int stack[N] = {};
+        int depth = 0;
+        int total = 0;
+        int node = root;
+        while (node != -1 || depth > 0) {
+            while (node != -1) {
+                stack[depth++] = node;
+                node = lefts[node];
+            }
+            node = stack[--depth];
+            sorted[total++] = vals[node];
+            node = rights[node];
+        }
+
+        count = 0;
+        root = buildHelper(sorted, 0, total - 1);
+    }
+
+    // Search operation
+    constexpr bool contains(int val) const {
+        int node = root;
+        while (node != -1) {
+            if (val < vals[node]) {
+                node = lefts[node];
+            } else if (val > vals[node]) {
+                node = rights[node];
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    constexpr int size() const {
+        return count;
+    }
+
+    // Inorder traversal
+    void inorderTraversal() const {
+        inorderHelper(root);
+        cout << endl;
+    }
+
+    // Preorder traversal
+    void preorderTraversal() const {
+        preorderHelper(root);
+        cout << endl;
+    }
+
+    // Postorder traversal
+    void postorderTraversal() const {
+        postorderHelper(root);
+        cout << endl;
+    }
+};
+
+// Builds a balanced StaticBST, deducing the capacity from the key list
+template <size_t N>
+constexpr StaticBST<N> makeStaticBST(const int (&keys)[N]) {
+    return StaticBST<N>(keys);
+}
+
 int main() {
     BST bst;
 
@@ -162,5 +496,31 @@ int main() {
     cout << "Inorder traversal after deletion: ";
     bst.inorderTraversal();
 
+    // Persistent tree: a snapshot keeps its version while writers continue
+    PersistentBST pbst;
+    pbst.insert(50);
+    pbst.insert(30);
+    pbst.insert(20);
+    pbst.insert(40);
+    pbst.insert(70);
+
+    BSTSnapshot before = pbst.snapshot();
+    pbst.deleteNode(30);
+    pbst.insert(60);
+
+    cout << "Snapshot inorder traversal: ";
+    before.inorderTraversal();
+
+    cout << "Current inorder traversal: ";
+    pbst.inorderTraversal();
+
+    // Static tree: built and balanced by the compiler, no heap at runtime
+    static constexpr StaticBST<7> staticBst = makeStaticBST({50, 30, 20, 40, 70, 60, 80});
+    static_assert(staticBst.contains(60), "60 is in the static tree");
+    static_assert(!staticBst.contains(65), "65 is not in the static tree");
+
+    cout << "Static preorder traversal: ";
+    staticBst.preorderTraversal();
+
     return 0;
 }